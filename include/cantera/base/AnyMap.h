@@ -326,6 +326,13 @@ private:
 
     mutable Comparer m_equals;
 
+    //! Write the value to a binary input cache file. See AnyMap::setInputCacheDir()
+    void writeBinary(std::ostream& out) const;
+
+    //! Read the value from a binary input cache file
+    void readBinary(std::istream& in);
+
+    friend class AnyMap;
     friend YAML::Emitter& YAML::operator<<(YAML::Emitter& out, const AnyValue& rhs);
 };
 
@@ -707,7 +714,40 @@ public:
     //! Remove the specified file from the input cache if it is present
     static void clearCachedFile(const string& filename);
 
+    //! Set the directory used to store parsed input files in a binary format
+    /*!
+     * If a cache directory is set, fromYamlFile() writes the contents of each
+     * YAML file it parses to a binary file in this directory. Later calls for a
+     * file with identical contents, including calls made by other processes,
+     * read the binary file instead of parsing the YAML file again. Only the
+     * parsed input data is cached; thermo, kinetics, and transport objects are
+     * still constructed from this data, so the time saved is the time spent in
+     * the YAML parser. Cache files are
+     * identified by a hash of the contents of the YAML file and are ignored if
+     * they were written by a different version of %Cantera. An empty string
+     * disables the cache. The initial value is taken from the environment
+     * variable `CANTERA_CACHE_DIR`, if it is set.
+     *
+     * @since New in %Cantera 3.2
+     */
+    static void setInputCacheDir(const string& dir);
+
+    //! Get the directory used to store parsed input files in a binary format.
+    //! See setInputCacheDir().
+    //! @since New in %Cantera 3.2
+    static string inputCacheDir();
+
 private:
+    //! Write the map to a binary input cache file. See setInputCacheDir()
+    void writeBinary(std::ostream& out) const;
+
+    //! Read the map from a binary input cache file
+    void readBinary(std::istream& in);
+
+    //! Create an AnyMap from the YAML file *fullName*, using the binary input
+    //! cache in directory *cacheDir* if possible. See setInputCacheDir().
+    static AnyMap fromInputCache(const string& fullName, const string& cacheDir);
+
     //! The stored data
     std::unordered_map<string, AnyValue> m_data;
 
@@ -716,9 +756,14 @@ private:
 
     //! Cache for previously-parsed input (YAML) files. The key is the full path
     //! to the file, and the second element of the value is the last-modified
-    //! time for the file, which is used to enable change detection.
-    static std::unordered_map<string,
-                              pair<AnyMap, std::filesystem::file_time_type>> s_cache;
+    //! time for the file, which is used to enable change detection. Cached maps
+    //! are never modified after they are added, so copies can be made from them
+    //! without holding the lock that guards the cache.
+    static std::unordered_map<string, pair<shared_ptr<const AnyMap>,
+                                           std::filesystem::file_time_type>> s_cache;
+
+    //! Directory used for binary input cache files. See setInputCacheDir().
+    static string s_inputCacheDir;
 
     //! Information about fields that should appear first when outputting to
     //! YAML. Keys in this map are matched to `__type__` keys in AnyMap
@@ -10,6 +10,7 @@
 #define CT_FACTORY_BASE
 
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/global.h"
@@ -33,10 +34,17 @@ public:
     //! static function that deletes all factories in the internal registry
     //! maintained in a static variable
     static void deleteFactories() {
-        for (const auto& f : s_vFactoryRegistry) {
+        // Factories lock their own mutex while being constructed or deleted, so
+        // the registry is released before deleting them to keep a consistent
+        // lock order
+        vector<FactoryBase*> factories;
+        {
+            std::unique_lock<std::mutex> lock(s_registryMutex);
+            factories.swap(s_vFactoryRegistry);
+        }
+        for (const auto& f : factories) {
             f->deleteFactory();
         }
-        s_vFactoryRegistry.clear();
     }
 
 protected:
@@ -46,6 +54,7 @@ protected:
      * Adds the current object to the current static list
      */
     FactoryBase() {
+        std::unique_lock<std::mutex> lock(s_registryMutex);
         s_vFactoryRegistry.push_back(this);
     }
 
@@ -58,6 +67,10 @@ protected:
 private:
     //! statically held list of Factories.
     static vector<FactoryBase*> s_vFactoryRegistry;
+
+    //! Mutex guarding #s_vFactoryRegistry, which is modified by factories that are
+    //! created concurrently on different threads
+    static std::mutex s_registryMutex;
 };
 
 //! Factory class that supports registering functions to create objects
@@ -65,6 +78,10 @@ private:
 //! Template arguments for the class are the base type created by the factory,
 //! followed by the types of any arguments which need to be passed to the
 //! functions used to create objects, that is, arguments to the constructor.
+//!
+//! Lookups of registered types may be made concurrently from multiple threads. They
+//! only acquire a shared lock, which is released before the construction function
+//! is called, while registering new types requires exclusive access.
 template <class T, typename ... Args>
 class Factory : public FactoryBase {
 public:
@@ -73,16 +90,23 @@ public:
     //! Create an object using the object construction function corresponding to
     //! "name" and the provided constructor arguments
     T* create(const string& name, Args... args) {
-        return m_creators.at(canonicalize(name))(args...);
+        function<T*(Args...)> creator;
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            creator = m_creators.at(canonicalName(name));
+        }
+        return creator(args...);
     }
 
     //! Register a new object construction function
     void reg(const string& name, function<T*(Args...)> f) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
         m_creators[name] = f;
     }
 
     //! Add an alias for an existing registered type
     void addAlias(const string& original, const string& alias) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
         if (!m_creators.count(original)) {
             throw CanteraError("Factory::addAlias",
                 "Name '{}' not registered", original);
@@ -92,22 +116,13 @@ public:
 
     //! Get the canonical name registered for a type
     string canonicalize(const string& name) {
-        if (m_creators.count(name)) {
-            return name;
-        } else if (m_synonyms.count(name)) {
-            return m_synonyms.at(name);
-        } else if (m_deprecated_names.count(name)) {
-            warn_deprecated("FactoryBase::canonicalize",
-                fmt::format("Model name '{}' is deprecated. Use '{}' instead.",
-                            name, m_deprecated_names.at(name)));
-            return m_deprecated_names.at(name);
-        } else {
-            throw CanteraError("Factory::canonicalize", "No such type: '{}'", name);
-        }
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return canonicalName(name);
     }
 
     //! Returns true if `name` is registered with this factory
     bool exists(const string& name) const {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
         return m_creators.count(name) || m_synonyms.count(name);
     }
 
@@ -115,6 +130,7 @@ protected:
     //! Add a deprecated alias for an existing registered type
     void addDeprecatedAlias(const string& original,
                             const string& alias) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
         if (!m_creators.count(original)) {
             throw CanteraError("Factory::addDeprecatedAlias",
                 "Name '{}' not registered", original);
@@ -123,6 +139,22 @@ protected:
     }
 
 private:
+    //! Get the canonical name registered for a type. The caller must hold #m_mutex.
+    const string& canonicalName(const string& name) const {
+        if (m_creators.count(name)) {
+            return name;
+        } else if (m_synonyms.count(name)) {
+            return m_synonyms.at(name);
+        } else if (m_deprecated_names.count(name)) {
+            warn_deprecated("FactoryBase::canonicalize",
+                fmt::format("Model name '{}' is deprecated. Use '{}' instead.",
+                            name, m_deprecated_names.at(name)));
+            return m_deprecated_names.at(name);
+        } else {
+            throw CanteraError("Factory::canonicalize", "No such type: '{}'", name);
+        }
+    }
+
     std::unordered_map<string, function<T*(Args...)>> m_creators;
 
     //! Map of synonyms to canonical names
@@ -131,6 +163,9 @@ private:
     //! Map of deprecated synonyms to canonical names. Use of these names will
     //! show a deprecation warning.
     std::unordered_map<string, string> m_deprecated_names;
+
+    //! Mutex guarding the maps of registered types and aliases
+    mutable std::shared_mutex m_mutex;
 };
 
 }
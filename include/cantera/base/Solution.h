@@ -55,6 +55,26 @@ public:
         return shared_ptr<Solution>( new Solution );
     }
 
+    //! Create an independent copy of this Solution object
+    /*!
+     * The copy has its own ThermoPhase, Kinetics, and Transport objects, which can
+     * be used independently of the original objects, for example by a different
+     * thread. Species and Reaction objects are created from the existing objects
+     * instead of from their input data, where Reaction objects and species transport
+     * data are shared with this object and each species thermo object is copied, and
+     * fitted transport properties are copied instead of being computed again. This
+     * makes creating a copy much faster than creating a new object from an input
+     * file. Adjacent phases are copied as well. See
+     * setupPhase(ThermoPhase&, const ThermoPhase&) and
+     * addReactions(Kinetics&, Kinetics&) for the settings that are copied.
+     *
+     * @warning Since Reaction objects are shared, they should be replaced using
+     *     Kinetics::modifyReaction() rather than modified in place. This method
+     *     should not be called concurrently for the same object.
+     * @since New in %Cantera 3.2
+     */
+    shared_ptr<Solution> clone();
+
     //! Return the name of this Solution object
     string name() const;
 
@@ -160,6 +180,10 @@ public:
     void removeChangedCallback(void* id);
 
 protected:
+    //! Implementation of clone(), where *related* maps Solution objects that
+    //! have already been copied to their copies
+    shared_ptr<Solution> clone(map<Solution*, shared_ptr<Solution>>& related);
+
     shared_ptr<ThermoPhase> m_thermo;  //!< ThermoPhase manager
     shared_ptr<Kinetics> m_kinetics;  //!< Kinetics manager
     shared_ptr<Transport> m_transport;  //!< Transport manager
@@ -170,6 +170,37 @@ public:
     //! Normalize mass/mole fractions
     void normalize();
 
+    /**
+     *  Set each entry of the SolutionArray to chemical equilibrium, holding the
+     *  properties specified by `XY` fixed. This is equivalent to calling
+     *  ThermoPhase::equilibrate() for each entry, but is intended for computing large
+     *  tables of equilibrium states.
+     *
+     *  The entries are first sorted along a space-filling curve in the space of
+     *  temperature, pressure, and elemental composition, and the sorted entries are
+     *  divided into contiguous blocks, one per thread. Each thread uses its own copy
+     *  of the phase, and each calculation with the element potential solver starts
+     *  from the solution of the previous entry in the same block (see
+     *  ChemEquil::setStartingEstimate). If the element potential solver fails and
+     *  `solver` is `"auto"`, the `"vcs"` and `"gibbs"` solvers are tried. Since the
+     *  starting estimates depend on the division into blocks, results obtained with
+     *  different numbers of threads agree to within the solver tolerance.
+     *
+     *  Entries where all solvers fail are left unchanged instead of raising an
+     *  exception. The outcome for each entry is stored in the extra components
+     *  - `equil-solver`: name of the solver that converged, or `"failed"`
+     *  - `equil-iterations`: number of iterations used by the element potential
+     *    solver, or -1 if a different solver was used
+     *
+     *  @param XY  Property pair to hold constant, for example `"TP"` or `"HP"`
+     *  @param solver  Name of the solver; one of `"auto"`, `"element_potential"`,
+     *      `"vcs"`, or `"gibbs"`
+     *  @param nThreads  Number of threads. If zero, the number of hardware threads is
+     *      used.
+     *  @since New in %Cantera 3.2
+     */
+    void equilibrate(const string& XY, const string& solver="auto", size_t nThreads=1);
+
     /**
      *  Add auxiliary component to SolutionArray. Initialization requires a subsequent
      *  call of setComponent().
@@ -244,6 +275,34 @@ public:
     void writeEntry(const string& fname, const string& name, const string& sub,
                     bool overwrite=false, int compression=0);
 
+    /**
+     *  Append SolutionArray data to extensible datasets in a HDF container file.
+     *
+     *  On the first call for a given location, a subgroup is created that holds
+     *  chunked datasets with an unlimited number of rows; subsequent calls extend these
+     *  datasets by the current contents of the SolutionArray. State data are written
+     *  directly from the internal storage buffer. Time histories of arbitrary length
+     *  can thus be stored in batches with bounded memory by resizing the SolutionArray
+     *  to zero after each call. The number of rows written by completed calls is
+     *  stored as the `size` attribute of the subgroup, which is only updated after all
+     *  datasets are extended. If the process is terminated during a call, restore()
+     *  thus reads consistent data from all completed calls, and partial rows are
+     *  overwritten by the next call.
+     *
+     *  @param fname  Name of HDF container file
+     *  @param name  Identifier of group holding header information
+     *  @param sub  Name identifier of subgroup holding SolutionArray data; if omitted
+     *      (`""`), the subgroup name defaults to `"data"`
+     *  @param compression  Compression level (0-9); only used when datasets are
+     *      created (default=0)
+     *  @param chunk  Number of rows per HDF chunk; only used when datasets are created
+     *      (default=1024)
+     *  @returns  Total number of entries stored at the location
+     *  @since New in %Cantera 3.2
+     */
+    size_t appendEntry(const string& fname, const string& name, const string& sub="",
+                       int compression=0, size_t chunk=1024);
+
     /**
      *  Write SolutionArray data to AnyMap. Used by YAML serialization.
      *
@@ -309,6 +368,21 @@ public:
      */
     static AnyMap readHeader(const AnyMap& root, const string& name);
 
+    /**
+     *  Restore SolutionArray data from a CSV file.
+     *
+     *  Reads files written by writeEntry(const string&, bool, const string&). Column
+     *  labels are matched to state properties and species (prefixed by `X_` or `Y_`
+     *  for mole or mass fractions); remaining columns are added as auxiliary
+     *  components, where the type (integer, floating point or string) is inferred
+     *  from the values. The file is processed in blocks, and state data are parsed
+     *  directly into the internal storage buffer.
+     *
+     *  @param fname  Name of CSV file
+     *  @since New in %Cantera 3.2
+     */
+    void readEntry(const string& fname);
+
     /**
      *  Restore SolutionArray data from a HDF container file.
      *
@@ -330,15 +404,17 @@ public:
     /**
      *  Restore SolutionArray data and header information from a container file.
      *
-     *  This method retrieves data from a YAML or HDF files that were previously saved
-     *  using the save() method.
+     *  This method retrieves data from a YAML, HDF or CSV files that were previously
+     *  saved using the save() method.
      *
-     *  @param fname  Name of container file (YAML or HDF)
+     *  @param fname  Name of data file (YAML, HDF or CSV)
      *  @param name  Identifier of location within the container file; this node/group
      *      contains header information and a subgroup holding actual SolutionArray data
+     *      (YAML/HDF only)
      *  @param sub  Name identifier for the subgroup holding the SolutionArray data and
      *      metadata objects. If omitted (`""`), the subgroup name defaults to "data"
-     *  @return  AnyMap containing header information
+     *      (YAML/HDF only)
+     *  @return  AnyMap containing header information (empty for CSV files)
      */
     AnyMap restore(const string& fname, const string& name, const string& sub="");
 
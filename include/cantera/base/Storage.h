@@ -49,6 +49,11 @@ public:
     //! sizes, which involves considerable overhead for metadata).
     void setCompressionLevel(int level);
 
+    //! Set number of rows per chunk used for extensible datasets
+    //! @see appendData
+    //! @since New in %Cantera 3.2
+    void setChunkSize(size_t rows);
+
     //! Check whether location `id` represents a group
     bool hasGroup(const string& id) const;
 
@@ -84,12 +89,16 @@ public:
     //! Write attributes to a specified location
     //! @param id  storage location within file
     //! @param meta  AnyMap containing attributes
-    void writeAttributes(const string& id, const AnyMap& meta);
+    //! @param overwrite  if `true`, existing attributes with the same names are
+    //!     replaced; otherwise, an exception is thrown (default=`false`)
+    void writeAttributes(const string& id, const AnyMap& meta, bool overwrite=false);
 
     //! Read dataset from a specified location
     //! @param id  storage location within file
     //! @param name  name of vector/matrix entry
-    //! @param rows  number of vector length or matrix rows
+    //! @param rows  number of vector length or matrix rows; if the dataset holds
+    //!     additional rows, for example left behind by an interrupted appendData()
+    //!     call, only the first *rows* rows are returned
     //! @param cols  number of matrix columns, if applicable; if 0, a vector is
     //!     expected, if npos, the size is detected automatically; otherwise, an exact
     //!     number of columns needs to be matched.
@@ -109,6 +118,70 @@ public:
     //!     `vector<vector<string>>`
     void writeData(const string& id, const string& name, const AnyValue& data);
 
+    //! Read dataset from a specified location into a strided buffer
+    //!
+    //! Data are read directly into the buffer without intermediate copies, where row
+    //! *i* starts at `data + i * stride`; entries between rows are not modified.
+    //! @param id  storage location within file
+    //! @param name  name of vector/matrix entry
+    //! @param data  pointer to the first element of the first row
+    //! @param rows  number of vector length or matrix rows; additional rows held by
+    //!     the dataset are ignored
+    //! @param cols  number of matrix columns; if 0, a vector is expected
+    //! @param stride  distance between first elements of consecutive rows; if 0, rows
+    //!     are assumed to be contiguous
+    //! @since New in %Cantera 3.2
+    void readData(const string& id, const string& name, double* data,
+                  size_t rows, size_t cols=0, size_t stride=0) const;
+
+    //! Write dataset from a strided buffer to a specified location
+    //!
+    //! Data are written directly from the buffer without intermediate copies, where
+    //! row *i* starts at `data + i * stride`.
+    //! @param id  storage location within file
+    //! @param name  name of vector/matrix entry
+    //! @param data  pointer to the first element of the first row
+    //! @param rows  number of vector length or matrix rows
+    //! @param cols  number of matrix columns; if 0, a vector is written
+    //! @param stride  distance between first elements of consecutive rows; if 0, rows
+    //!     are assumed to be contiguous
+    //! @since New in %Cantera 3.2
+    void writeData(const string& id, const string& name, const double* data,
+                   size_t rows, size_t cols=0, size_t stride=0);
+
+    //! Append rows of a strided buffer to an extensible dataset
+    //!
+    //! If the dataset does not exist, it is created with an unlimited first dimension
+    //! and chunked storage (see setChunkSize), where compression is applied according
+    //! to setCompressionLevel(). Row *i* starts at `data + i * stride` and is written
+    //! directly from the buffer without intermediate copies.
+    //! @param id  storage location within file
+    //! @param name  name of vector/matrix entry
+    //! @param data  pointer to the first element of the first row
+    //! @param rows  number of rows to be appended
+    //! @param cols  number of matrix columns; if 0, a vector is used
+    //! @param stride  distance between first elements of consecutive rows; if 0, rows
+    //!     are assumed to be contiguous
+    //! @param offset  row at which appended data start; rows of an existing dataset
+    //!     beyond this point are discarded. If npos, data are appended after the
+    //!     last row of the dataset (default).
+    //! @returns  number of rows held by the dataset after appending
+    //! @since New in %Cantera 3.2
+    size_t appendData(const string& id, const string& name, const double* data,
+                      size_t rows, size_t cols=0, size_t stride=0,
+                      size_t offset=npos);
+
+    //! Append entries to an extensible one-dimensional dataset
+    //! @param id  storage location within file
+    //! @param name  name of vector entry
+    //! @param data  vector containing data; implemented for types `vector<double>`,
+    //!     `vector<long int>` and `vector<string>`
+    //! @param offset  row at which appended data start; see above (default=npos)
+    //! @returns  number of rows held by the dataset after appending
+    //! @since New in %Cantera 3.2
+    size_t appendData(const string& id, const string& name, const AnyValue& data,
+                      size_t offset=npos);
+
 private:
 #if CT_USE_HDF5
     //! ensure that HDF group is readable
@@ -120,6 +193,7 @@ private:
     unique_ptr<HighFive::File> m_file; //!< HDF container file
     bool m_write; //!< HDF access mode
     int m_compressionLevel=0; //!< HDF compression level
+    size_t m_chunkSize=1024; //!< Rows per chunk of extensible datasets
 #endif
 };
 
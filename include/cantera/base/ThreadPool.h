@@ -0,0 +1,81 @@
+/**
+ *  @file ThreadPool.h
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_THREADPOOL_H
+#define CT_THREADPOOL_H
+
+#include "ct_defs.h"
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Cantera
+{
+
+/**
+ * A fixed-size pool of worker threads used to evaluate loops in parallel.
+ *
+ * The thread calling parallelFor() participates in the work, so a pool of size
+ * `n` creates `n - 1` worker threads. Loop indices are divided into contiguous
+ * blocks which are always assigned to the same thread, so that the work done by
+ * each thread (and therefore the result of any thread-specific computation) is
+ * deterministic for a given pool size.
+ *
+ * A ThreadPool may only be used by one calling thread at a time.
+ *
+ * @since New in %Cantera 3.2
+ * @ingroup globalUtilFuncs
+ */
+class ThreadPool
+{
+public:
+    //! Create a pool that uses `nThreads` threads, including the calling thread.
+    //! If `nThreads` is zero, the number of hardware threads is used.
+    explicit ThreadPool(size_t nThreads);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //! Number of threads used by the pool, including the calling thread.
+    size_t size() const {
+        return m_workers.size() + 1;
+    }
+
+    //! Call `func(i, thread)` for `0 <= i < n`, where `thread` is the index of the
+    //! thread (between 0 and size() - 1) evaluating iteration `i`. Returns after all
+    //! iterations have been completed. If any iteration throws an exception, the
+    //! exception raised by the lowest-numbered thread is rethrown.
+    void parallelFor(size_t n, const std::function<void(size_t, size_t)>& func);
+
+private:
+    //! Main loop for each worker thread
+    void work(size_t thread);
+
+    //! Evaluate the block of iterations assigned to `thread`
+    void runBlock(size_t thread);
+
+    vector<std::thread> m_workers; //!< Worker threads
+    std::mutex m_mutex; //!< Mutex protecting the task state
+    std::condition_variable m_start; //!< Signals availability of a new task
+    std::condition_variable m_done; //!< Signals completion of all worker blocks
+
+    //! Function evaluated by the current task
+    const std::function<void(size_t, size_t)>* m_task = nullptr;
+    size_t m_n = 0; //!< Number of iterations in the current task
+    size_t m_generation = 0; //!< Counter identifying the current task
+    size_t m_pending = 0; //!< Number of worker threads still busy with the task
+    bool m_stop = false; //!< Set when the pool is being destroyed
+
+    //! Exception raised by each thread during the current task, if any
+    vector<std::exception_ptr> m_errors;
+};
+
+}
+
+#endif
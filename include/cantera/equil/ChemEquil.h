@@ -47,8 +47,16 @@ public:
      * Continuation flag. Set true if the calculation should be initialized from
      * the last calculation. Otherwise, the calculation will be started from
      * scratch and the initial composition and element potentials estimated.
+     * @see ChemEquil::setStartingEstimate
      */
     bool contin = false;
+
+    /**
+     * Use an analytic Jacobian for ideal gas phases. If false, or for other phase
+     * types, the Jacobian is evaluated using finite differences.
+     * @since New in %Cantera 3.2
+     */
+    bool analyticJacobian = true;
 };
 
 /**
@@ -120,6 +128,24 @@ public:
     int equilibrate(ThermoPhase& s, const char* XY, vector<double>& elMoles,
                     int loglevel = 0);
 
+    /**
+     * Use the composition and temperature of the phase *s* as the starting estimate
+     * for subsequent calls to equilibrate() when EquilOpt::contin is set. Typically,
+     * *s* is the equilibrium state of a neighboring point, for example when
+     * computing equilibrium states on a grid of conditions. This replaces the
+     * estimate of the temperature and the initial mole numbers, which usually
+     * dominate the cost of a calculation. If the calculation fails to converge from
+     * this estimate, it is repeated with the default starting estimate. The
+     * estimate is not used for property pairs where the temperature is fixed, for
+     * which the default estimate is inexpensive.
+     *
+     * The state of each successful calculation is stored automatically, so with
+     * EquilOpt::contin set, each calculation starts from the previous solution.
+     *
+     * @since New in %Cantera 3.2
+     */
+    void setStartingEstimate(const ThermoPhase& s);
+
     /**
      * Options controlling how the calculation is carried out.
      * @see EquilOpt
@@ -229,6 +255,18 @@ protected:
                        const vector<double>& elmols, DenseMatrix& jac,
                        double xval, double yval, int loglevel = 0);
 
+    //! Evaluate the Jacobian of the residual computed by equilResidual()
+    //! analytically for an ideal gas phase.
+    //! @since New in %Cantera 3.2
+    void equilJacobianIdealGas(ThermoPhase& s, vector<double>& x,
+                               const vector<double>& elmols, DenseMatrix& jac,
+                               double xval, double yval);
+
+    //! Implementation of equilibrate(), starting from the estimate set by
+    //! setStartingEstimate() if *warmStart* is `true`.
+    int solveEquilibrium(ThermoPhase& s, const char* XY, vector<double>& elMoles,
+                         int loglevel, bool warmStart);
+
     void adjustEloc(ThermoPhase& s, vector<double>& elMolesGoal);
 
     //! Update internally stored state information.
@@ -283,6 +321,12 @@ protected:
 
     vector<double> m_startSoln;
 
+    //! Mole fractions used as the starting estimate. See setStartingEstimate().
+    vector<double> m_startX;
+
+    //! Temperature used as the starting estimate. See setStartingEstimate().
+    double m_startT = 0.0;
+
     vector<double> m_grt;
     vector<double> m_mu_RT;
 
@@ -29,10 +29,63 @@ class AnyMap;
 struct ArrheniusData : public ReactionData
 {
     bool update(const ThermoPhase& phase, const Kinetics& kin) override;
+    void update(const ReactionState& state) override;
     using ReactionData::update;
 };
 
 
+//! Packed parameters of Arrhenius-type rate expressions
+/*!
+ * Structure-of-arrays container used by MultiRate to evaluate rate constants of the
+ * form
+ *
+ *   @f[
+ *        k_f = A \, \exp (b \, \xi - E_a/R \, \eta + E_4/R \, \zeta)
+ *   @f]
+ *
+ * for all reactions of a given Arrhenius-type rate parameterization in a single loop.
+ * The auxiliary variables @f$ \xi @f$, @f$ \eta @f$ and @f$ \zeta @f$ are shared by
+ * all reactions and depend on the rate type; for ArrheniusRate, @f$ \xi = \ln T @f$,
+ * @f$ \eta = 1/T @f$, and @f$ \zeta = 0 @f$. Pre-exponential factors are stored
+ * directly (rather than their logarithms), which preserves support for negative
+ * values and yields results identical to ArrheniusRate::evalFromStruct.
+ *
+ * @see PackedRateTraits
+ * @ingroup arrheniusGroup
+ * @since New in %Cantera 3.2
+ */
+struct PackedArrheniusParameters
+{
+    //! Resize arrays to hold parameters for *n* reactions
+    void resize(size_t n) {
+        A.resize(n, NAN);
+        b.resize(n, NAN);
+        Ea_R.resize(n, 0.);
+        E4_R.resize(n, 0.);
+        kf.resize(n, NAN);
+    }
+
+    //! Evaluate rate constants of all reactions; results are stored in #kf.
+    void eval(double xi, double eta, double zeta) {
+        size_t n = kf.size();
+        const double* A_ = A.data();
+        const double* b_ = b.data();
+        const double* Ea_ = Ea_R.data();
+        const double* E4_ = E4_R.data();
+        double* kf_ = kf.data();
+        for (size_t i = 0; i < n; i++) {
+            kf_[i] = A_[i] * std::exp(b_[i] * xi - Ea_[i] * eta + E4_[i] * zeta);
+        }
+    }
+
+    vector<double> A; //!< Pre-exponential factors
+    vector<double> b; //!< Temperature exponents
+    vector<double> Ea_R; //!< Activation energies (in temperature units)
+    vector<double> E4_R; //!< Coefficients of auxiliary term (in temperature units)
+    vector<double> kf; //!< Evaluated rate constants
+};
+
+
 //! Base class for Arrhenius-type Parameterizations
 /*!
  * This base class provides a minimally functional interface that allows for parameter
@@ -142,6 +195,15 @@ public:
         m_negativeA_ok = value;
     }
 
+    //! Store parameters in position *i* of packed arrays used by MultiRate
+    //! @since New in %Cantera 3.2
+    void packParameters(PackedArrheniusParameters& packed, size_t i) const {
+        packed.A[i] = m_A;
+        packed.b[i] = m_b;
+        packed.Ea_R[i] = m_Ea_R;
+        packed.E4_R[i] = 0.;
+    }
+
 protected:
     bool m_negativeA_ok = false; //!< Permissible negative A values
     double m_A = NAN; //!< Pre-exponential factor
@@ -156,6 +218,16 @@ protected:
     string m_E4_str = ""; //!< The string for an optional 4th parameter
 };
 
+class ArrheniusRate;
+
+//! Enable packed evaluation of ArrheniusRate in MultiRate
+template <>
+struct PackedRateTraits<ArrheniusRate>
+{
+    static constexpr bool enabled = true;
+    using Packed = PackedArrheniusParameters;
+};
+
 //! Arrhenius reaction rate type depends only on temperature
 /*!
  * A reaction rate coefficient of the following form.
@@ -197,6 +269,17 @@ public:
         return m_A * std::exp(m_b * shared_data.logT - m_Ea_R * shared_data.recipT);
     }
 
+    //! Evaluate reaction rates of all reactions held in packed parameter arrays
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param packed  packed parameters; results are stored in `packed.kf`
+     *  @since New in %Cantera 3.2
+     */
+    static void evalPackedFromStruct(const ArrheniusData& shared_data,
+                                     PackedArrheniusParameters& packed) {
+        packed.eval(shared_data.logT, shared_data.recipT, 0.);
+    }
+
     //! Evaluate derivative of reaction rate with respect to temperature
     //! divided by reaction rate
     /*!
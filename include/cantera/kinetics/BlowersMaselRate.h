@@ -22,6 +22,7 @@ struct BlowersMaselData : public ReactionData
 
     void update(double T) override;
     bool update(const ThermoPhase& phase, const Kinetics& kin) override;
+    void update(const ReactionState& state) override;
     using ReactionData::update;
 
     void resize(size_t nSpecies, size_t nReactions, size_t nPhases) override {
@@ -38,6 +39,16 @@ protected:
 };
 
 
+class BlowersMaselRate;
+
+//! Enable packed evaluation of BlowersMaselRate in MultiRate
+template <>
+struct PackedRateTraits<BlowersMaselRate>
+{
+    static constexpr bool enabled = true;
+    using Packed = PackedArrheniusParameters;
+};
+
 //! Blowers Masel reaction rate type depends on the enthalpy of reaction
 /**
  * The Blowers Masel approximation @cite blowers2000 adjusts the activation energy
@@ -122,6 +133,30 @@ public:
         return m_A * std::exp(m_b * shared_data.logT - Ea_R * shared_data.recipT);
     }
 
+    //! Store parameters in position *i* of packed arrays used by MultiRate
+    /*!
+     *  The effective activation energy depends on the enthalpy of reaction and is
+     *  refreshed by MultiRate whenever updateFromStruct() is called.
+     *  @since New in %Cantera 3.2
+     */
+    void packParameters(PackedArrheniusParameters& packed, size_t i) const {
+        packed.A[i] = m_A;
+        packed.b[i] = m_b;
+        packed.Ea_R[i] = effectiveActivationEnergy_R(m_deltaH_R);
+        packed.E4_R[i] = 0.;
+    }
+
+    //! Evaluate reaction rates of all reactions held in packed parameter arrays
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param packed  packed parameters; results are stored in `packed.kf`
+     *  @since New in %Cantera 3.2
+     */
+    static void evalPackedFromStruct(const BlowersMaselData& shared_data,
+                                     PackedArrheniusParameters& packed) {
+        packed.eval(shared_data.logT, shared_data.recipT, 0.);
+    }
+
     //! Evaluate derivative of reaction rate with respect to temperature
     //! divided by reaction rate
     /*!
@@ -84,6 +84,16 @@ public:
 
     void updateROP() override;
 
+    //! @copydoc Kinetics::getNetProductionRatesBatch
+    //!
+    //! States are processed in blocks. For each block, reference state properties,
+    //! concentrations and equilibrium constants are evaluated first, followed by the
+    //! rate constants of each reaction type (see MultiRateBase::getRateConstantsBatch)
+    //! and the rates of progress. All intermediate results are held in local
+    //! work arrays.
+    void getNetProductionRatesBatch(size_t n, const double* T, const double* P,
+                                    const double* Y, double* wdot) override;
+
     void getThirdBodyConcentrations(double* concm) override;
     const vector<double>& thirdBodyConcentrations() const override {
         return m_concm;
@@ -34,6 +34,12 @@ struct ChebyshevData : public ReactionData
 
     bool update(const ThermoPhase& phase, const Kinetics& kin) override;
 
+    void update(const ReactionState& state) override {
+        if (state.pressure != pressure || state.temperature != temperature) {
+            update(state.temperature, state.pressure);
+        }
+    }
+
     using ReactionData::update;
 
     //! Perturb pressure of data container
@@ -57,6 +63,74 @@ protected:
     double m_pressure_buf = -1.0; //!< buffered pressure
 };
 
+//! Packed parameters of Chebyshev rate expressions
+/*!
+ * Container used by MultiRate to evaluate all ChebyshevRate objects of a Kinetics
+ * object together. Coefficient matrices of all reactions are zero-padded to a common
+ * size @f$ N_T \times N_P @f$ and stored such that the coefficients
+ * @f$ \alpha_{tp} @f$ of all reactions are contiguous, that is, the coefficient
+ * @f$ \alpha_{tp} @f$ of reaction *i* is stored at position
+ * @f$ (t N_P + p) n + i @f$, where *n* is the number of reactions. Contractions of the
+ * coefficient matrices with the Chebyshev polynomials in reduced pressure and
+ * temperature then become loops over all reactions that are amenable to
+ * auto-vectorization. As terms with zero coefficients do not contribute, results
+ * match ChebyshevRate::evalFromStruct except for round-off introduced by evaluating
+ * @f$ 10^x @f$ as @f$ \exp(x \ln 10) @f$, which is considerably faster.
+ *
+ * @see PackedRateTraits
+ * @ingroup otherRateGroup
+ * @since New in %Cantera 3.2
+ */
+struct PackedChebyshevParameters
+{
+    //! Resize arrays to hold parameters for *n* reactions
+    void resize(size_t n);
+
+    //! Set parameters of the reaction at position *i*
+    void set(size_t i, double TrNum, double TrDen, double PrNum, double PrDen,
+             const Array2D& coeffs);
+
+    //! Update the contraction of the coefficients with the Chebyshev polynomials in
+    //! reduced pressure, where *log10P* is the base 10 logarithm of pressure.
+    void updatePressure(double log10P);
+
+    //! Evaluate rate constants of all reactions at the inverse temperature *recipT*;
+    //! results are stored in #kf.
+    void eval(double recipT);
+
+    size_t nT = 1; //!< Number of coefficients in the temperature direction
+    size_t nP = 1; //!< Number of coefficients in the pressure direction
+    vector<double> TrNum; //!< Terms appearing in the reduced temperature
+    vector<double> TrDen; //!< Terms appearing in the reduced temperature
+    vector<double> PrNum; //!< Terms appearing in the reduced pressure
+    vector<double> PrDen; //!< Terms appearing in the reduced pressure
+    vector<double> coeffs; //!< Zero-padded coefficient matrices of all reactions
+    //! Contraction of the coefficients with the reduced pressure polynomials, where
+    //! the entry for temperature index *t* and reaction *i* is at `t * n + i`
+    vector<double> dotProd;
+    double log10P = NAN; //!< Base 10 logarithm of pressure used for #dotProd
+    vector<double> kf; //!< Evaluated rate constants
+
+protected:
+    //! Change the layout of #coeffs and #dotProd to hold *n* reactions with
+    //! coefficient matrices of size *nT_* by *nP_*
+    void reshape(size_t n, size_t nT_, size_t nP_);
+
+    vector<double> m_x; //!< Work array holding reduced pressures or temperatures
+    vector<double> m_cn; //!< Work array holding Chebyshev polynomials of degree n
+    vector<double> m_cnm1; //!< Work array holding Chebyshev polynomials of degree n-1
+};
+
+class ChebyshevRate;
+
+//! Enable packed evaluation of ChebyshevRate in MultiRate
+template <>
+struct PackedRateTraits<ChebyshevRate>
+{
+    static constexpr bool enabled = true;
+    using Packed = PackedChebyshevParameters;
+};
+
 //! Pressure-dependent rate expression where the rate coefficient is expressed
 //! as a bivariate Chebyshev polynomial in temperature and pressure.
 /*!
@@ -170,6 +244,37 @@ public:
         return std::pow(10, logk);
     }
 
+    //! Store parameters in position *i* of packed arrays used by MultiRate
+    //! @since New in %Cantera 3.2
+    void packParameters(PackedChebyshevParameters& packed, size_t i) const {
+        packed.set(i, TrNum_, TrDen_, PrNum_, PrDen_, m_coeffs);
+    }
+
+    //! Update pressure-dependent terms of all reactions held in packed parameter
+    //! arrays
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param packed  packed parameters
+     *  @since New in %Cantera 3.2
+     */
+    static void updatePackedFromStruct(const ChebyshevData& shared_data,
+                                       PackedChebyshevParameters& packed) {
+        if (shared_data.log10P != packed.log10P) {
+            packed.updatePressure(shared_data.log10P);
+        }
+    }
+
+    //! Evaluate reaction rates of all reactions held in packed parameter arrays
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param packed  packed parameters; results are stored in `packed.kf`
+     *  @since New in %Cantera 3.2
+     */
+    static void evalPackedFromStruct(const ChebyshevData& shared_data,
+                                     PackedChebyshevParameters& packed) {
+        packed.eval(shared_data.recipT);
+    }
+
     //! Set limits for ChebyshevRate object
     /*!
      *  @param Tmin    Minimum temperature [K]
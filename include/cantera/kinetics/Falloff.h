@@ -23,6 +23,8 @@ struct FalloffData : public ReactionData
 
     bool update(const ThermoPhase& phase, const Kinetics& kin) override;
 
+    void update(const ReactionState& state) override;
+
     void update(double T) override;
 
     void update(double T, double M) override;
@@ -154,28 +156,31 @@ public:
 
     //! Evaluate reaction rate
     //! @param shared_data  data shared by all reactions of a given type
-    double evalFromStruct(const FalloffData& shared_data) {
-        updateTemp(shared_data.temperature, m_work.data());
-        m_rc_low = m_lowRate.evalRate(shared_data.logT, shared_data.recipT);
-        m_rc_high = m_highRate.evalRate(shared_data.logT, shared_data.recipT);
+    double evalFromStruct(const FalloffData& shared_data) const {
+        // Intermediate results are kept in local storage instead of m_work, which
+        // allows concurrent evaluation, see MultiRate::getRateConstantsBatch
+        double work[s_maxWorkSize];
+        updateTemp(shared_data.temperature, work);
+        double rc_low = m_lowRate.evalRate(shared_data.logT, shared_data.recipT);
+        double rc_high = m_highRate.evalRate(shared_data.logT, shared_data.recipT);
         double thirdBodyConcentration;
         if (shared_data.ready) {
             thirdBodyConcentration = shared_data.conc_3b[m_rate_index];
         } else {
             thirdBodyConcentration = shared_data.conc_3b[0];
         }
-        double pr = thirdBodyConcentration * m_rc_low / (m_rc_high + SmallNumber);
+        double pr = thirdBodyConcentration * rc_low / (rc_high + SmallNumber);
 
         // Apply falloff function
         if (m_chemicallyActivated) {
             // 1 / (1 + Pr) * F
-            pr = F(pr, m_work.data()) / (1.0 + pr);
-            return pr * m_rc_low;
+            pr = F(pr, work) / (1.0 + pr);
+            return pr * rc_low;
         }
 
         // Pr / (1 + Pr) * F
-        pr *= F(pr, m_work.data()) / (1.0 + pr);
-        return pr * m_rc_high;
+        pr *= F(pr, work) / (1.0 + pr);
+        return pr * rc_high;
     }
 
     void check(const string& equation) override;
@@ -239,6 +244,9 @@ protected:
     double m_rc_low = NAN; //!< Evaluated reaction rate in the low-pressure limit
     double m_rc_high = NAN; //!< Evaluated reaction rate in the high-pressure limit
     vector<double> m_work; //!< Work vector
+
+    //! Largest size of #m_work required by any of the falloff parameterizations
+    static constexpr size_t s_maxWorkSize = 2;
 };
 
 
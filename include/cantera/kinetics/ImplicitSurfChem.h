@@ -218,6 +218,12 @@ public:
         m_ioFlag = ioFlag;
     }
 
+    //! Set whether solvePseudoSteadyStateProblem() evaluates the Jacobian
+    //! analytically where possible. Default `true`.
+    //! @see solveSP::setAnalyticJacobian
+    //! @since New in %Cantera 3.2
+    void setAnalyticJacobian(bool analytic);
+
 protected:
     //! Set the mixture to a state consistent with solution
     //! vector y.
@@ -294,6 +300,10 @@ protected:
     //! phases associated with the surface problem is imposed
     bool m_commonTempPressForPhases = true;
 
+    //! If true, the pseudo steady state solver uses an analytic Jacobian where
+    //! possible
+    bool m_analyticJacobian = true;
+
 private:
     //! Controls the amount of printing from this routine
     //! and underlying routines.
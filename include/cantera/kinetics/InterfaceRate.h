@@ -36,6 +36,11 @@ struct InterfaceData : public BlowersMaselData
 
     void update(double T, const vector<double>& values) override;
 
+    //! Not supported, as surface coverages are not part of ReactionState
+    void update(const ReactionState& state) override {
+        ReactionData::update(state);
+    }
+
     using BlowersMaselData::update;
 
     virtual void perturbTemperature(double deltaT);
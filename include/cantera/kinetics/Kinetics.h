@@ -561,6 +561,33 @@ public:
      */
     virtual void getNetProductionRates(double* wdot);
 
+    /**
+     * Species net production rates [kmol/m^3/s] for a batch of thermodynamic
+     * states. Each state is specified by temperature, pressure and mass fractions
+     * of the phase associated with this kinetics manager. Mass fractions and
+     * results are stored in cell-major order, that is, entries for state `i` are
+     * contiguous and start at `Y[i * nSpecies]` and `wdot[i * nTotalSpecies()]`,
+     * respectively. Neither the state of the phase nor any cached data of the
+     * kinetics manager are modified. Several threads can therefore call this method
+     * concurrently for the same object, provided that no other methods of this
+     * object or of the associated phase are called at the same time. This includes
+     * methods that only set the state of the phase, since these may update data
+     * that is read by this method, such as the packed species thermo tables (see
+     * MultiSpeciesThermo::update).
+     *
+     * Currently only implemented by BulkKinetics for ideal gas phases.
+     *
+     * @param n      Number of states
+     * @param T      Temperatures [K]. Length: *n*.
+     * @param P      Pressures [Pa]. Length: *n*.
+     * @param Y      Mass fractions. Length: *n* times the number of species.
+     * @param wdot   Output array of net production rates. Length: *n* times #m_kk.
+     * @since New in %Cantera 3.2
+     */
+    virtual void getNetProductionRatesBatch(size_t n, const double* T,
+                                            const double* P, const double* Y,
+                                            double* wdot);
+
     //! @}
 
     //! @addtogroup derivGroup
@@ -85,6 +85,22 @@ shared_ptr<Kinetics> newKinetics(const vector<shared_ptr<ThermoPhase>>& phases,
 void addReactions(Kinetics& kin, const AnyMap& phaseNode,
                   const AnyMap& rootNode=AnyMap());
 
+/**
+ * Add the reactions of an existing Kinetics object to a Kinetics object.
+ *
+ * The Reaction objects of *other* are shared rather than being created from their
+ * input data again, which avoids the cost of processing the reaction definitions.
+ * Settings for handling undeclared species and third bodies, rate multipliers, and
+ * derivative settings are copied.
+ *
+ * @param kin    The Kinetics object to be initialized; this should be a newly
+ *     created object of the same type as *other*, for phases with the same species
+ *     as the phases of *other*
+ * @param other  The existing Kinetics object
+ * @since New in %Cantera 3.2
+ */
+void addReactions(Kinetics& kin, Kinetics& other);
+
 //! @}
 
 }
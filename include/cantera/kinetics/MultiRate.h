@@ -15,17 +15,60 @@
 namespace Cantera
 {
 
+//! Traits for ReactionRate specializations supporting packed evaluation.
+/*!
+ * By default, MultiRate evaluates rate constants by calling `evalFromStruct` for each
+ * reaction in turn. Rate types that can be expressed by a small, fixed number of
+ * parameters per reaction may instead opt into a packed evaluation path by
+ * specializing this template, where parameters of all reactions handled by a MultiRate
+ * object are held in contiguous arrays (structure-of-arrays layout) and rate constants
+ * are evaluated in a single loop that is amenable to auto-vectorization. Results are
+ * subsequently scattered into the full array of rate constants.
+ *
+ * Specializations set `enabled` to `true` and define the container type `Packed`,
+ * which has to provide a `resize(size_t)` method and hold evaluated rate constants in
+ * a member `vector<double> kf`. In addition, the rate type needs to implement the
+ * methods `packParameters(Packed& packed, size_t i) const` and
+ * `static evalPackedFromStruct(const DataType& shared_data, Packed& packed)`. Rate types
+ * with state-dependent parameters that are expensive to update (for example, the
+ * pressure-dependent terms of ChebyshevRate and PlogRate) may also implement
+ * `static updatePackedFromStruct(const DataType& shared_data, Packed& packed)`, which
+ * then replaces calls to `updateFromStruct` for individual reactions.
+ *
+ * Specializations only apply to the exact rate type, that is, derived rate types
+ * (for example InterfaceRate) fall back to the default evaluation path.
+ *
+ * @see ArrheniusRate, BlowersMaselRate, TwoTempPlasmaRate, ChebyshevRate, PlogRate
+ * @ingroup rateEvaluators
+ * @since New in %Cantera 3.2
+ */
+template <class RateType>
+struct PackedRateTraits
+{
+    static constexpr bool enabled = false;
+    struct Packed {};
+};
+
 //! A class template handling ReactionRate specializations.
 //! @ingroup rateEvaluators
 template <class RateType, class DataType>
 class MultiRate final : public MultiRateBase
 {
     CT_DEFINE_HAS_MEMBER(has_update, updateFromStruct)
+    CT_DEFINE_HAS_MEMBER(has_updatePacked, updatePackedFromStruct)
     CT_DEFINE_HAS_MEMBER(has_modifyRateConstants, modifyRateConstants)
     CT_DEFINE_HAS_MEMBER(has_ddT, ddTScaledFromStruct)
     CT_DEFINE_HAS_MEMBER(has_ddP, perturbPressure)
     CT_DEFINE_HAS_MEMBER(has_ddM, perturbThirdBodies)
 
+    //! Detect rate types where `evalFromStruct` does not modify the rate object
+    template<class T, class=void>
+    struct has_constEval : std::false_type {};
+    template<class T>
+    struct has_constEval<T, std::void_t<decltype(
+        std::declval<const T&>().evalFromStruct(std::declval<const DataType&>()))>>
+        : std::true_type {};
+
 public:
     string type() override {
         if (!m_rxn_rates.size()) {
@@ -38,6 +81,10 @@ public:
     void add(size_t rxn_index, ReactionRate& rate) override {
         m_indices[rxn_index] = m_rxn_rates.size();
         m_rxn_rates.emplace_back(rxn_index, dynamic_cast<RateType&>(rate));
+        if constexpr (s_packed) {
+            m_packed.resize(m_rxn_rates.size());
+            m_rxn_rates.back().second.packParameters(m_packed, m_rxn_rates.size() - 1);
+        }
         m_shared.invalidateCache();
     }
 
@@ -56,6 +103,9 @@ public:
         if (m_indices.find(rxn_index) != m_indices.end()) {
             size_t j = m_indices[rxn_index];
             m_rxn_rates.at(j).second = dynamic_cast<RateType&>(rate);
+            if constexpr (s_packed) {
+                m_rxn_rates[j].second.packParameters(m_packed, j);
+            }
             return true;
         }
         return false;
@@ -67,8 +117,71 @@ public:
     }
 
     void getRateConstants(double* kf) override {
-        for (auto& [iRxn, rate] : m_rxn_rates) {
-            kf[iRxn] = rate.evalFromStruct(m_shared);
+        if constexpr (s_packed) {
+            RateType::evalPackedFromStruct(m_shared, m_packed);
+            _scatter(m_packed.kf.data(), kf);
+        } else {
+            for (auto& [iRxn, rate] : m_rxn_rates) {
+                kf[iRxn] = rate.evalFromStruct(m_shared);
+            }
+        }
+    }
+
+    void getRateConstantsBatch(size_t n, const ReactionState* states, double* kf,
+                               size_t stride) const override
+    {
+        DataType data = m_shared;
+        if constexpr (s_packed) {
+            auto packed = m_packed;
+            if constexpr (has_update<RateType>::value
+                          && !has_updatePacked<RateType>::value)
+            {
+                // packed parameters depend on state-dependent members of the rate
+                // objects, which are updated for each state
+                auto rates = m_rxn_rates;
+                for (size_t j = 0; j < n; j++) {
+                    data.update(states[j]);
+                    for (size_t i = 0; i < rates.size(); i++) {
+                        rates[i].second.updateFromStruct(data);
+                        rates[i].second.packParameters(packed, i);
+                    }
+                    RateType::evalPackedFromStruct(data, packed);
+                    _scatter(packed.kf.data(), kf + j * stride);
+                }
+            } else {
+                for (size_t j = 0; j < n; j++) {
+                    data.update(states[j]);
+                    if constexpr (has_updatePacked<RateType>::value) {
+                        RateType::updatePackedFromStruct(data, packed);
+                    }
+                    RateType::evalPackedFromStruct(data, packed);
+                    _scatter(packed.kf.data(), kf + j * stride);
+                }
+            }
+        } else if constexpr (has_constEval<RateType>::value
+                             && !has_update<RateType>::value)
+        {
+            for (size_t j = 0; j < n; j++) {
+                data.update(states[j]);
+                double* kf_j = kf + j * stride;
+                for (const auto& [iRxn, rate] : m_rxn_rates) {
+                    kf_j[iRxn] = rate.evalFromStruct(data);
+                }
+            }
+        } else {
+            // evaluation may modify rate objects, for example to cache intermediate
+            // results, which requires local copies
+            auto rates = m_rxn_rates;
+            for (size_t j = 0; j < n; j++) {
+                data.update(states[j]);
+                double* kf_j = kf + j * stride;
+                for (auto& [iRxn, rate] : rates) {
+                    if constexpr (has_update<RateType>::value) {
+                        rate.updateFromStruct(data);
+                    }
+                    kf_j[iRxn] = rate.evalFromStruct(data);
+                }
+            }
         }
     }
 
@@ -93,9 +206,11 @@ public:
             _update();
 
             // apply numerical derivative
-            for (auto& [iRxn, rate] : m_rxn_rates) {
+            _evalPerturbed();
+            for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+                size_t iRxn = m_rxn_rates[i].first;
                 if (kf[iRxn] != 0.) {
-                    double k1 = rate.evalFromStruct(m_shared);
+                    double k1 = _perturbedRate(i);
                     rop[iRxn] *= dTinv * (k1 / kf[iRxn] - 1.);
                 } // else not needed: derivative is already zero
             }
@@ -113,9 +228,11 @@ public:
             m_shared.perturbPressure(deltaP);
             _update();
 
-            for (auto& [iRxn, rate] : m_rxn_rates) {
+            _evalPerturbed();
+            for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+                size_t iRxn = m_rxn_rates[i].first;
                 if (kf[iRxn] != 0.) {
-                    double k1 = rate.evalFromStruct(m_shared);
+                    double k1 = _perturbedRate(i);
                     rop[iRxn] *= dPinv * (k1 / kf[iRxn] - 1.);
                 } // else not needed: derivative is already zero
             }
@@ -138,9 +255,11 @@ public:
             m_shared.perturbThirdBodies(deltaM);
             _update();
 
-            for (auto& [iRxn, rate] : m_rxn_rates) {
+            _evalPerturbed();
+            for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+                size_t iRxn = m_rxn_rates[i].first;
                 if (kf[iRxn] != 0. && m_shared.conc_3b[iRxn] > 0.) {
-                    double k1 = rate.evalFromStruct(m_shared);
+                    double k1 = _perturbedRate(i);
                     rop[iRxn] *= dMinv * (k1 / kf[iRxn] - 1.);
                     rop[iRxn] /= m_shared.conc_3b[iRxn];
                 } else {
@@ -204,17 +323,56 @@ public:
 protected:
     //! Helper function to process updates
     void _update() {
-        if constexpr (has_update<RateType>::value) {
-            for (auto& [i, rxn] : m_rxn_rates) {
+        if constexpr (s_packed && has_updatePacked<RateType>::value) {
+            RateType::updatePackedFromStruct(m_shared, m_packed);
+        } else if constexpr (has_update<RateType>::value) {
+            for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+                auto& rxn = m_rxn_rates[i].second;
                 rxn.updateFromStruct(m_shared);
+                if constexpr (s_packed) {
+                    // state-dependent parameters need to be refreshed
+                    rxn.packParameters(m_packed, i);
+                }
             }
         }
     }
 
+    //! Helper function copying packed rate constants to the full array *kf*
+    void _scatter(const double* kf_packed, double* kf) const {
+        for (size_t i = 0; i < m_rxn_rates.size(); i++) {
+            kf[m_rxn_rates[i].first] = kf_packed[i];
+        }
+    }
+
+    //! Helper function evaluating rate constants at perturbed conditions, which
+    //! are subsequently accessed using _perturbedRate()
+    void _evalPerturbed() {
+        if constexpr (s_packed) {
+            RateType::evalPackedFromStruct(m_shared, m_packed);
+        }
+    }
+
+    //! Helper function returning the rate constant of the reaction at position *i*
+    //! of #m_rxn_rates at perturbed conditions
+    double _perturbedRate(size_t i) {
+        if constexpr (s_packed) {
+            return m_packed.kf[i];
+        } else {
+            return m_rxn_rates[i].second.evalFromStruct(m_shared);
+        }
+    }
+
+    //! Flag indicating whether the packed evaluation path is used
+    static constexpr bool s_packed = PackedRateTraits<RateType>::enabled;
+
     //! Vector of pairs of reaction rates indices and reaction rates
     vector<pair<size_t, RateType>> m_rxn_rates;
     map<size_t, size_t> m_indices; //! Mapping of indices
     DataType m_shared;
+
+    //! Packed rate parameters, with entries in the same order as #m_rxn_rates. Only
+    //! used if PackedRateTraits is specialized for RateType.
+    typename PackedRateTraits<RateType>::Packed m_packed;
 };
 
 }
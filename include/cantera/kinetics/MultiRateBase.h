@@ -16,6 +16,7 @@ namespace Cantera
 class ReactionRate;
 class ThermoPhase;
 class Kinetics;
+struct ReactionState;
 
 //! An abstract base class for evaluating all reactions of a particular type.
 /**
@@ -52,6 +53,24 @@ public:
     //! @param kf  array of rate constants
     virtual void getRateConstants(double* kf) = 0;
 
+    //! Evaluate all rate constants handled by the evaluator for a batch of states
+    /*!
+     * Rate constants are evaluated using local copies of the data shared by all
+     * reactions and of any state-dependent parameters, that is, the evaluator itself
+     * is not modified and does not need to be updated beforehand.
+     *
+     * @param n  number of states
+     * @param states  array of length *n* holding the states
+     * @param[out] kf  rate constants; the entry for reaction `i` at state `j` is
+     *     stored at `kf[j * stride + i]`. Entries of reactions not handled by this
+     *     evaluator are not modified.
+     * @param stride  offset between the rate constants of consecutive states, which
+     *     is at least the total number of reactions
+     * @since New in %Cantera 3.2
+     */
+    virtual void getRateConstantsBatch(size_t n, const ReactionState* states,
+                                       double* kf, size_t stride) const = 0;
+
     //! For certain reaction types that do not follow mass action kinetics (for example,
     //! Butler-Volmer), calculate modifications to the forward and reverse rate
     //! constants.
@@ -30,6 +30,12 @@ struct PlogData : public ReactionData
 
     bool update(const ThermoPhase& phase, const Kinetics& kin) override;
 
+    void update(const ReactionState& state) override {
+        if (state.pressure != pressure || state.temperature != temperature) {
+            update(state.temperature, state.pressure);
+        }
+    }
+
     using ReactionData::update;
 
     //! Perturb pressure of data container
@@ -53,6 +59,87 @@ protected:
     double m_pressure_buf = -1.0; //!< buffered pressure
 };
 
+//! Packed interpolation tables of PLOG rate expressions
+/*!
+ * Container used by MultiRate to evaluate all PlogRate objects of a Kinetics object
+ * together. For each reaction, the pressure grid and the Arrhenius expressions given
+ * at each pressure are stored in a table. Reactions sharing the same pressure grid,
+ * which is common for mechanisms generated by automated tools, are grouped, such
+ * that the interpolation interval only needs to be located once per distinct grid
+ * whenever the pressure changes. The Arrhenius expressions at the lower and upper
+ * pressures of the current intervals of all reactions are then gathered into a single
+ * PackedArrheniusParameters object, which is evaluated in one loop before the
+ * logarithmic interpolation is applied to all reactions. Results are identical to
+ * PlogRate::evalFromStruct.
+ *
+ * @see PackedRateTraits
+ * @ingroup otherRateGroup
+ * @since New in %Cantera 3.2
+ */
+struct PackedPlogParameters
+{
+    //! Resize arrays to hold parameters for *n* reactions
+    void resize(size_t n);
+
+    //! Set the interpolation table of the reaction at position *i*
+    /*!
+     *  @param i  position of the reaction
+     *  @param pressures  mapping of log(p) to index ranges within *rates*,
+     *      including the entries used for extrapolation to low and high pressures
+     *  @param rates  Arrhenius expressions referenced by *pressures*
+     */
+    void set(size_t i, const map<double, pair<size_t, size_t>>& pressures,
+             const vector<ArrheniusRate>& rates);
+
+    //! Locate interpolation intervals for the natural logarithm of pressure *logP*
+    void updatePressure(double logP);
+
+    //! Evaluate rate constants of all reactions; results are stored in #kf.
+    void eval(double logT, double recipT);
+
+    double logP = NAN; //!< Natural logarithm of pressure used for interpolation
+    vector<double> kf; //!< Evaluated rate constants
+
+protected:
+    //! Interpolation table of a single reaction
+    struct Table
+    {
+        vector<double> logP; //!< Pressure grid, including extrapolation entries
+        //! Offsets of the Arrhenius expressions for each pressure within #terms
+        vector<size_t> offsets;
+        PackedArrheniusParameters terms; //!< Arrhenius expressions
+        size_t grid = npos; //!< Index of the pressure grid within #m_grids
+    };
+
+    //! Group reactions by distinct pressure grids
+    void groupGrids();
+
+    vector<Table> m_tables; //!< Interpolation tables of all reactions
+    bool m_grouped = false; //!< Flag indicating that #m_grids is up to date
+    vector<vector<double>> m_grids; //!< Distinct pressure grids
+    //! Index of the upper pressure of the current interpolation interval of each grid
+    vector<size_t> m_intervals;
+
+    //! Arrhenius expressions at the pressures bounding the current interpolation
+    //! intervals of all reactions
+    PackedArrheniusParameters m_active;
+    //! Offsets within #m_active, where the expressions at the lower and upper
+    //! pressures of reaction *i* start at entries `2 * i` and `2 * i + 1`,
+    //! respectively, and end at the following entry.
+    vector<size_t> m_activeOffsets;
+    vector<double> m_logP1; //!< Lower pressure of the interpolation interval
+    vector<double> m_rDeltaP; //!< Reciprocal of (logP2 - logP1)
+};
+
+class PlogRate;
+
+//! Enable packed evaluation of PlogRate in MultiRate
+template <>
+struct PackedRateTraits<PlogRate>
+{
+    static constexpr bool enabled = true;
+    using Packed = PackedPlogParameters;
+};
 
 //! Pressure-dependent reaction rate expressed by logarithmically interpolating
 //! between Arrhenius rate expressions at various pressures.
@@ -163,6 +250,37 @@ public:
         return std::exp(log_k1 + (log_k2 - log_k1) * (logP_ - logP1_) * rDeltaP_);
     }
 
+    //! Store parameters in position *i* of packed arrays used by MultiRate
+    //! @since New in %Cantera 3.2
+    void packParameters(PackedPlogParameters& packed, size_t i) const {
+        packed.set(i, pressures_, rates_);
+    }
+
+    //! Update interpolation intervals of all reactions held in packed parameter
+    //! arrays
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param packed  packed parameters
+     *  @since New in %Cantera 3.2
+     */
+    static void updatePackedFromStruct(const PlogData& shared_data,
+                                       PackedPlogParameters& packed) {
+        if (shared_data.logP != packed.logP) {
+            packed.updatePressure(shared_data.logP);
+        }
+    }
+
+    //! Evaluate reaction rates of all reactions held in packed parameter arrays
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param packed  packed parameters; results are stored in `packed.kf`
+     *  @since New in %Cantera 3.2
+     */
+    static void evalPackedFromStruct(const PlogData& shared_data,
+                                     PackedPlogParameters& packed) {
+        packed.eval(shared_data.logT, shared_data.recipT);
+    }
+
     //! Set up Plog object
     void setRates(const std::multimap<double, ArrheniusRate>& rates);
 
@@ -17,6 +17,29 @@ namespace Cantera
 class ThermoPhase;
 class Kinetics;
 
+//! Thermodynamic state used to update ReactionData without accessing a phase
+/**
+ * Holds the state information required by the ReactionData specializations used
+ * for reactions in a single bulk phase. This allows rate constants to be evaluated
+ * for states other than the current state of the phase associated with a Kinetics
+ * object, for example in Kinetics::getNetProductionRatesBatch.
+ * @ingroup reactionGroup
+ * @since New in %Cantera 3.2
+ */
+struct ReactionState
+{
+    double temperature = NAN; //!< temperature [K]
+    double pressure = NAN; //!< pressure [Pa]
+    double density = NAN; //!< mass density [kg/m^3]
+    double molarDensity = NAN; //!< molar density [kmol/m^3]
+
+    //! Effective third-body concentrations [kmol/m^3]. Length: number of reactions.
+    const double* thirdBodyConcentrations = nullptr;
+
+    //! Partial molar enthalpies [J/kmol]. Length: number of species.
+    const double* partialMolarEnthalpies = nullptr;
+};
+
 
 //! Data container holding shared data used for ReactionRate calculation
 /**
@@ -74,6 +97,18 @@ struct ReactionData
      */
     virtual bool update(const ThermoPhase& phase, const Kinetics& kin) = 0;
 
+    //! Update data container based on a thermodynamic state that is not held by a
+    //! phase object
+    /**
+     * This update mechanism is used by MultiRateBase::getRateConstantsBatch, and
+     * requires the data container to be sized by a previous call to resize().
+     * @since New in %Cantera 3.2
+     */
+    virtual void update(const ReactionState& state) {
+        throw NotImplementedError("ReactionData::update",
+            "ReactionData type does not support updates from ReactionState.");
+    }
+
     //! Perturb temperature of data container
     /**
      * The method is used for the evaluation of numerical derivatives.
@@ -73,6 +73,12 @@ public:
 
     //! Update third-body concentrations in full vector
     void update(const vector<double>& conc, double ctot, double* concm) const {
+        update(conc.data(), ctot, concm);
+    }
+
+    //! Update third-body concentrations in full array
+    //! @since New in %Cantera 3.2
+    void update(const double* conc, double ctot, double* concm) const {
         for (size_t i = 0; i < m_reaction_index.size(); i++) {
             double sum = 0.0;
             for (size_t j = 0; j < m_species[i].size(); j++) {
@@ -83,7 +89,7 @@ public:
     }
 
     //! Multiply output with effective third-body concentration
-    void multiply(double* output, const double* concm) {
+    void multiply(double* output, const double* concm) const {
         for (size_t i = 0; i < m_mass_action_index.size(); i++) {
             size_t ix = m_reaction_index[m_mass_action_index[i]];
             output[ix] *= concm[ix];
@@ -39,6 +39,16 @@ struct TwoTempPlasmaData : public ReactionData
 };
 
 
+class TwoTempPlasmaRate;
+
+//! Enable packed evaluation of TwoTempPlasmaRate in MultiRate
+template <>
+struct PackedRateTraits<TwoTempPlasmaRate>
+{
+    static constexpr bool enabled = true;
+    using Packed = PackedArrheniusParameters;
+};
+
 //! Two temperature plasma reaction rate type depends on both
 //! gas temperature and electron temperature.
 /*!
@@ -96,6 +106,28 @@ public:
                               * shared_data.recipTe * shared_data.recipT);
     }
 
+    //! Store parameters in position *i* of packed arrays used by MultiRate
+    //! @since New in %Cantera 3.2
+    void packParameters(PackedArrheniusParameters& packed, size_t i) const {
+        packed.A[i] = m_A;
+        packed.b[i] = m_b;
+        packed.Ea_R[i] = m_Ea_R;
+        packed.E4_R[i] = m_E4_R;
+    }
+
+    //! Evaluate reaction rates of all reactions held in packed parameter arrays
+    /*!
+     *  @param shared_data  data shared by all reactions of a given type
+     *  @param packed  packed parameters; results are stored in `packed.kf`
+     *  @since New in %Cantera 3.2
+     */
+    static void evalPackedFromStruct(const TwoTempPlasmaData& shared_data,
+                                     PackedArrheniusParameters& packed) {
+        double zeta = (shared_data.electronTemp - shared_data.temperature)
+                      * shared_data.recipTe * shared_data.recipT;
+        packed.eval(shared_data.logTe, shared_data.recipT, zeta);
+    }
+
     //! Evaluate derivative of reaction rate with respect to temperature
     //! divided by reaction rate
     /*!
@@ -186,6 +186,40 @@ public:
     int solveSurfProb(int ifunc, double time_scale, double TKelvin,
                       double PGas, double reltol, double abstol);
 
+    //! Set whether the Jacobian is evaluated analytically
+    /*!
+     * If `true` (default), the Jacobian of the surface species equations is
+     * evaluated from the derivatives of the net production rates with respect to
+     * the species concentrations provided by
+     * InterfaceKinetics::netRatesOfProgress_ddCi(), which replaces one residual
+     * evaluation per surface species. If these derivatives are not available for
+     * one of the InterfaceKinetics objects, for example for mechanisms with
+     * coverage-dependent rates where the derivative setting
+     * `skip-coverage-dependence` is not enabled, or if bulk phase equations are
+     * solved, the Jacobian is evaluated using finite differences.
+     *
+     * Since the residual is evaluated exactly in either case, an approximate
+     * analytic Jacobian only affects the convergence rate of the Newton
+     * iteration and not the converged solution.
+     *
+     * @since New in %Cantera 3.2
+     */
+    void setAnalyticJacobian(bool analytic) {
+        m_analyticJacobian = analytic;
+    }
+
+    //! Number of Jacobian evaluations using the analytic derivatives
+    //! @since New in %Cantera 3.2
+    int nAnalyticJacobianEvals() const {
+        return m_nJacAnalytic;
+    }
+
+    //! Number of Jacobian evaluations using finite differences
+    //! @since New in %Cantera 3.2
+    int nFiniteDifferenceJacobianEvals() const {
+        return m_nJacFiniteDiff;
+    }
+
 private:
     //! Printing routine that optionally gets called at the start of every
     //! invocation
@@ -304,6 +338,17 @@ private:
                      const double* CSolnSPOld, const bool do_time,
                      const double deltaT);
 
+    //! Evaluate the Jacobian from the concentration derivatives of the net
+    //! production rates, at the state set by the last call to fun_eval()
+    /*!
+     *  @param jac     Jacobian to be evaluated.
+     *  @param do_time Calculate a time dependent Jacobian
+     *  @param deltaT  Delta time for time dependent problem.
+     *  @returns `false` if the derivatives are not available for one of the
+     *      InterfaceKinetics objects
+     */
+    bool analyticJacobian(DenseMatrix& jac, const bool do_time, const double deltaT);
+
     //! Vector of interface kinetics objects
     /*!
      * Each of these is associated with one and only one surface phase.
@@ -479,6 +524,22 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! Use the analytic Jacobian if the required derivatives are available. Set
+    //! to `false` if the derivatives are found to be unavailable.
+    bool m_analyticJacobian = true;
+
+    //! Index of each kinetic species in the solution vector, or `npos` if the
+    //! species is not one of the unknowns. Outer index is the index of the
+    //! InterfaceKinetics object.
+    vector<vector<size_t>> m_solnIndexKinSpecies;
+
+    int m_nJacAnalytic = 0; //!< Number of analytic Jacobian evaluations
+    int m_nJacFiniteDiff = 0; //!< Number of finite difference Jacobian evaluations
+
+    //! Damping factor used in the previous Newton step, which limits the growth
+    //! of the damping factor in the following step
+    double m_dampOld = 1.0;
+
 public:
     int m_ioflag = 0;
 };
@@ -20,6 +20,13 @@ namespace Cantera
 //! the preconditioner by a threshold value. It also neglects pressure
 //! dependence and third body contributions in its formation and has a
 //! finite difference approximation for temperature.
+//!
+//! By default, the sparsity pattern of the preconditioner is reused between updates:
+//! if the elements set with setValue() have the same positions (in the same order) as
+//! in the previous update, their values are written directly into the existing sparse
+//! matrix, and only the numerical part of the ILUT factorization is repeated, while the
+//! fill-reducing ordering computed for the first matrix with this pattern is reused.
+//! The resulting preconditioner is identical to the one obtained without reuse.
 class AdaptivePreconditioner : public EigenSparseJacobian
 {
 public:
@@ -27,6 +34,9 @@ public:
 
     void initialize(size_t networkSize) override;
     const string type() const override { return "Adaptive"; }
+    void reset() override;
+    void updatePreconditioner() override;
+    void updateTransient(double rdt, int* mask) override;
     void setup() override; // deprecated
     void factorize() override;
     void solve(const size_t stateSize, double* rhs_vector, double* output) override;
@@ -69,6 +79,27 @@ public:
         m_solver.setFillfactor(fillFactor);
     }
 
+    //! Set whether the sparsity pattern and the fill-reducing ordering of the
+    //! preconditioner are reused between updates. Enabled by default.
+    //! @since New in %Cantera 3.2
+    void setReusePattern(bool reuse) {
+        m_reusePattern = reuse;
+        m_patternValid = false;
+    }
+
+    //! Get whether the sparsity pattern is reused between updates
+    //! @since New in %Cantera 3.2
+    bool reusePattern() const {
+        return m_reusePattern;
+    }
+
+    //! Number of times the fill-reducing ordering of the preconditioner has been
+    //! computed since the last call to initialize().
+    //! @since New in %Cantera 3.2
+    int nPatternAnalyses() const {
+        return m_nAnalyses;
+    }
+
 protected:
     //! ILUT fill factor
     double m_fill_factor = 0;
@@ -85,6 +116,28 @@ protected:
 
     //! Bool set whether to prune the matrix or not
     double m_prune_precon = true;
+
+    //! Flag indicating whether the sparsity pattern is reused between updates
+    bool m_reusePattern = true;
+
+    //! Flag indicating that #m_matrix has the pattern described by #m_pattern
+    bool m_patternValid = false;
+
+    //! Flag indicating that the next factorization can reuse the fill-reducing
+    //! ordering of the previous one
+    bool m_refactorOnly = false;
+
+    //! Row and column of each Jacobian element used to create #m_matrix
+    vector<pair<int, int>> m_pattern;
+
+    //! Position of each Jacobian element within the values of #m_matrix
+    vector<Eigen::Index> m_valueIndex;
+
+    //! Positions of the diagonal elements within the values of #m_matrix
+    vector<Eigen::Index> m_diagIndex;
+
+    //! Number of analyses of the sparsity pattern. See nPatternAnalyses()
+    int m_nAnalyses = 0;
 };
 
 }
@@ -12,16 +12,40 @@ namespace Cantera
 {
 
 //! A system matrix solver that uses Eigen's sparse direct (LU) algorithm
+//!
+//! The symbolic analysis of the sparsity pattern (which includes computing the
+//! fill-reducing column ordering) is reused between factorizations. Elements that
+//! were present in a previously analyzed pattern are stored as explicit zeros, so
+//! the analysis only needs to be repeated if new elements appear, or after calling
+//! initialize().
 class EigenSparseDirectJacobian : public EigenSparseJacobian
 {
 public:
     EigenSparseDirectJacobian() = default;
     const string type() const override { return "eigen-sparse-direct"; }
+    void initialize(size_t networkSize) override;
     void factorize() override;
     void solve(const size_t stateSize, double* rhs_vector, double* output) override;
 
+    //! Returns zero if the last factorization or solve was successful, or -1
+    //! otherwise.
+    int info() const override;
+
+    //! Number of times the symbolic analysis of the sparsity pattern has been
+    //! performed since the last call to initialize().
+    //! @since New in %Cantera 3.2
+    int nPatternAnalyses() const {
+        return m_nAnalyses;
+    }
+
 protected:
     Eigen::SparseLU<Eigen::SparseMatrix<double>> m_solver;
+
+    //! Sparsity pattern used for the last symbolic analysis, with all values zero
+    Eigen::SparseMatrix<double> m_pattern;
+
+    //! Number of symbolic analyses. See nPatternAnalyses()
+    int m_nAnalyses = 0;
 };
 
 }
@@ -114,6 +114,15 @@ public:
         throw NotImplementedError("FuncEval::updatePreconditioner");
     }
 
+    //! Indicates whether the Jacobian data used by the preconditioner was
+    //! re-evaluated during the last call to preconditionerSetup(). Implementations
+    //! may reuse previously evaluated Jacobian data, in which case the integrator
+    //! can request a re-evaluation if the nonlinear solver fails to converge.
+    //! @since New in %Cantera 3.2
+    virtual bool preconditionerJacobianCurrent() const {
+        return true;
+    }
+
     /**
      * Preconditioner setup that doesn't throw an error but returns a
      * CVODES flag. It also helps as a first level of polymorphism
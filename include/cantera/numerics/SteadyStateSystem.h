@@ -57,6 +57,15 @@ public:
     //! OneDim::weightedNorm() for a representative implementation.
     virtual double weightedNorm(const double* step) const = 0;
 
+    //! Get the error weights used by weightedNorm() to normalize each component of a
+    //! step vector, such that the weighted norm is the root-mean-square value of
+    //! `step[i] / ewt[i]`. The default implementation sets all weights to one.
+    //! @param[out] ewt  Array of length size()
+    //! @since New in %Cantera 3.2
+    virtual void getErrorWeights(double* ewt) const {
+        std::fill(ewt, ewt + size(), 1.0);
+    }
+
     //! Solve @f$ F(x) = 0 @f$, where @f$ F(x) @f$ is the residual function.
     //!
     //! @param[in] x0  Starting estimate of solution.
@@ -135,6 +144,29 @@ public:
     //! linear systems as part of each Newton iteration.
     shared_ptr<SystemJacobian> linearSolver() const { return m_jac; }
 
+    //! Set whether Newton steps are computed using a Jacobian-free Newton-Krylov
+    //! (JFNK) method.
+    //!
+    //! In this mode, the linear system for each Newton step is solved using GMRES,
+    //! where the product of the Jacobian with a vector is approximated using a
+    //! directional finite difference of the residual function. The matrix held by
+    //! linearSolver() is then used only as a preconditioner, which derived classes
+    //! may approximate more cheaply than the full Jacobian; see
+    //! OneDim::evalJacobian(). The setting takes effect for the next call to solve().
+    //! @see MultiNewton::setKrylovOptions
+    //! @since New in %Cantera 3.2
+    void setJacobianFree(bool jfnk) {
+        m_jacobianFree = jfnk;
+        m_jac_ok = false;
+    }
+
+    //! Returns `true` if Newton steps are computed using a Jacobian-free
+    //! Newton-Krylov method. @see setJacobianFree()
+    //! @since New in %Cantera 3.2
+    bool jacobianFree() const {
+        return m_jacobianFree;
+    }
+
     //! Reciprocal of the time step.
     double rdt() const {
         return m_rdt;
@@ -295,6 +327,7 @@ protected:
 
     shared_ptr<SystemJacobian> m_jac; //!< Jacobian evaluator
     bool m_jac_ok = false; //!< If `true`, Jacobian is current
+    bool m_jacobianFree = false; //!< Use a Jacobian-free Newton-Krylov method
 
     size_t m_bw = 0; //!< Jacobian bandwidth
     size_t m_size = 0; //!< %Solution vector size
@@ -325,6 +325,21 @@ public:
         throw NotImplementedError("Domain1D::eval");
     }
 
+    //! Prepare for evaluating the perturbed residuals used to compute the finite
+    //! difference Jacobian.
+    //!
+    //! Called by OneDim::evalJacobian after the residual has been evaluated at the
+    //! unperturbed state `xGlobal`. Domains may use this to replace expensive terms of
+    //! the residual by linearizations that are evaluated analytically.
+    //! @since New in %Cantera 3.2
+    virtual void startJacobianEvaluation(const double* xGlobal) {}
+
+    //! Called by OneDim::evalJacobian after all perturbed residuals have been
+    //! evaluated.
+    //! @see startJacobianEvaluation
+    //! @since New in %Cantera 3.2
+    virtual void finishJacobianEvaluation() {}
+
     /**
      * Returns the index of the solution vector, which corresponds to component
      * n at grid point j.
@@ -11,6 +11,7 @@
 #include "cantera/base/Solution.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/kinetics/Kinetics.h"
+#include "cantera/numerics/eigen_sparse.h"
 
 namespace Cantera
 {
@@ -32,6 +33,7 @@ enum offset
 };
 
 class Transport;
+class ThreadPool;
 
 //! @defgroup flowGroup Flow Domains
 //! One-dimensional flow domains.
@@ -244,6 +246,63 @@ public:
         return m_do_radiation;
     }
 
+    //! Set the number of threads used to evaluate thermodynamic, kinetic, and
+    //! transport properties at the grid points.
+    //!
+    //! If more than one thread is used, grid points are partitioned among the
+    //! threads, where each additional thread uses an independent copy of the
+    //! Solution object associated with this domain. These copies are created from
+    //! the current definition of the phase, kinetics, and transport models, and are
+    //! recreated if the kinetics or transport models are replaced. Changes of
+    //! reaction rate multipliers (Kinetics::setMultiplier) and heats of formation
+    //! (ThermoPhase::modifyOneHf298SS) are copied to all threads before properties are
+    //! evaluated, as used for sensitivity analysis. Other changes, such as species or
+    //! reactions modified in place, require calling this method again to take effect
+    //! on all threads.
+    //!
+    //! Properties are evaluated in parallel only when evaluating the full residual.
+    //! To also parallelize the Jacobian evaluation, use OneDim::setColoredJacobian.
+    //!
+    //! @param nThreads  Number of threads, including the calling thread. If zero,
+    //!     the number of hardware threads is used.
+    //! @since New in %Cantera 3.2
+    void setNumThreads(size_t nThreads);
+
+    //! Number of threads used to evaluate properties at the grid points.
+    //! @see setNumThreads
+    //! @since New in %Cantera 3.2
+    size_t numThreads() const;
+
+    //! Set whether the Jacobian contributions of the chemical source terms are
+    //! evaluated analytically.
+    //!
+    //! If enabled, the derivatives of the species production rates with respect to
+    //! temperature and mass fractions at each grid point are evaluated analytically
+    //! using the Kinetics derivative methods (for example,
+    //! Kinetics::netProductionRates_ddX) at the start of each Jacobian evaluation.
+    //! While evaluating the perturbed residuals used for the finite difference
+    //! Jacobian, the production rates are then replaced by their linearization,
+    //! which avoids re-evaluating the reaction rates and makes the chemical source
+    //! term blocks of the Jacobian analytic (subject to the derivative settings).
+    //! Accuracy of the derivatives can be controlled using
+    //! Kinetics::setDerivativeSettings. Other terms, such as convection and
+    //! diffusion, are still evaluated by finite differences.
+    //! @since New in %Cantera 3.2
+    void setAnalyticChemistryJacobian(bool analytic) {
+        m_analyticChemJac = analytic;
+    }
+
+    //! Returns `true` if the chemical source terms of the Jacobian are evaluated
+    //! analytically.
+    //! @see setAnalyticChemistryJacobian
+    //! @since New in %Cantera 3.2
+    bool analyticChemistryJacobian() const {
+        return m_analyticChemJac;
+    }
+
+    void startJacobianEvaluation(const double* xGlobal) override;
+    void finishJacobianEvaluation() override;
+
     //! Return radiative heat loss at grid point j
     double radiativeHeatLoss(size_t j) const {
         return m_qdotRadiation[j];
@@ -433,16 +492,7 @@ protected:
      * * #m_hk (species specific enthalpies)
      * * #m_wdot (species production rates)
      */
-    void updateThermo(const double* x, size_t j0, size_t j1) {
-        for (size_t j = j0; j <= j1; j++) {
-            setGas(x,j);
-            m_rho[j] = m_thermo->density();
-            m_wtm[j] = m_thermo->meanMolecularWeight();
-            m_cp[j] = m_thermo->cp_mass();
-            m_thermo->getPartialMolarEnthalpies(&m_hk(0, j));
-            m_kin->getNetProductionRates(&m_wdot(0, j));
-        }
-    }
+    void updateThermo(const double* x, size_t j0, size_t j1);
 
     /**
      * Update the transport properties at grid points in the range from `j0`
@@ -871,6 +921,21 @@ protected:
     //! Array of size #m_nsp by #m_points for saving thermal diffusion coefficients
     Array2D m_dthermal;
 
+    //! Array of size #m_nsp by #m_points for saving the constraint weights of the
+    //! Stefan-Maxwell equations, if these are solved iteratively.
+    //! @see MultiTransport::getStefanMaxwellSystem
+    Array2D m_multiWeights;
+
+    //! Array of size #m_nsp by #m_points for saving the diffusion velocities at each
+    //! interval (multiplied by the grid spacing and pressure) computed by
+    //! updateTransport() when the Stefan-Maxwell equations are solved iteratively.
+    //! These are used as the initial guess for the next solution.
+    Array2D m_diffVelocity;
+
+    //! Array of size #m_nsp by #m_points for saving the mole fraction differences
+    //! across each interval for which #m_diffVelocity was computed
+    Array2D m_diffDeltaX;
+
     //! Array of size #m_nsp by #m_points for saving diffusive mass fluxes
     Array2D m_flux;
 
@@ -926,6 +991,16 @@ protected:
     //! coefficients, or `false` if mixture-averaged diffusion coefficients are used.
     bool m_do_multicomponent = false;
 
+    //! `true` if multicomponent diffusive fluxes are computed by solving the
+    //! Stefan-Maxwell equations iteratively at each interval, which is the case for
+    //! the `multicomponent-iterative` transport model.
+    bool m_iterativeMultiDiff = false;
+
+    //! `true` while a Jacobian is being evaluated. Used to keep the solution of the
+    //! Stefan-Maxwell equations fixed if the transport properties are updated by
+    //! residual evaluations for perturbed states.
+    bool m_evaluatingJacobian = false;
+
     //! Determines whether radiative heat loss is calculated.
     //! @see enableRadiation, radiationEnabled, computeRadiation
     bool m_do_radiation = false;
@@ -999,10 +1074,82 @@ public:
     double m_tfixed = -1.0;
 
 private:
+    //! Set the state of `thermo` to be consistent with the solution at point `j`.
+    void setGasState(ThermoPhase& thermo, const double* x, size_t j) const;
+
+    //! Set the state of `thermo` to be consistent with the solution at the midpoint
+    //! between `j` and `j + 1`, using `ybar` as work space for the mass fractions.
+    void setGasStateAtMidpoint(ThermoPhase& thermo, double* ybar, const double* x,
+                               size_t j) const;
+
+    //! Call `func(j, thread)` for each grid point `j0 <= j < j1`, distributing the
+    //! points among the threads used for evaluating properties.
+    //! @see setNumThreads
+    void forEachPoint(size_t j0, size_t j1,
+                      const std::function<void(size_t, size_t)>& func);
+
+    //! Create the copies of #m_solution used by threads other than the calling
+    //! thread.
+    void updateThreadSolutions();
+
+    //! Copy reaction rate multipliers and heats of formation of #m_solution which
+    //! changed since the last update to #m_threadSolutions.
+    void syncThreadSolutions();
+
+    //! Evaluate the linearization of the species production rates at point `j`
+    //! about the state stored at the start of the Jacobian evaluation, using `work`
+    //! as work space of length #m_nsp.
+    //! @see setAnalyticChemistryJacobian
+    void linearizedProductionRates(const double* x, size_t j, double* wdot,
+                                   double* work) const;
+
     //! Holds the average of the species mass fractions between grid points j and j+1.
     //! Used when building a gas state at the grid midpoints for evaluating transport
     //! properties at the midpoints.
     vector<double> m_ybar;
+
+    //! Thread pool used for evaluating properties. Not set if only one thread is used.
+    unique_ptr<ThreadPool> m_pool;
+
+    //! Copies of #m_solution used by threads `1` to `n - 1`; thread `0` uses the
+    //! objects of #m_solution directly.
+    vector<shared_ptr<Solution>> m_threadSolutions;
+
+    //! Work space equivalent to #m_ybar for threads `1` to `n - 1`.
+    vector<vector<double>> m_threadYbar;
+
+    //! Heats of formation [J/kmol] of the species last copied to #m_threadSolutions
+    vector<double> m_threadHf298;
+
+    //! @name Analytic chemistry Jacobian
+    //! Data used to linearize the species production rates while evaluating the
+    //! Jacobian. See setAnalyticChemistryJacobian()
+    //! @{
+
+    //! `true` if the chemical source terms of the Jacobian are evaluated analytically
+    bool m_analyticChemJac = false;
+
+    //! `true` while production rates are replaced by their linearization
+    bool m_linearizedChem = false;
+
+    //! Local solution vector at which the production rates are linearized
+    vector<double> m_x0;
+
+    //! Species production rates at the linearization point, size #m_nsp by #m_points
+    Array2D m_wdot0;
+
+    //! Derivatives of the production rates with respect to temperature at constant
+    //! pressure and composition, size #m_nsp by #m_points
+    Array2D m_dwdot_dT;
+
+    //! Derivatives of the production rates with respect to mole fractions at each
+    //! interior grid point
+    vector<Eigen::SparseMatrix<double>> m_dwdot_dX;
+
+    //! Product of #m_dwdot_dX and the mole fractions at each grid point, size #m_nsp
+    //! by #m_points
+    Array2D m_dwdot_dX_X;
+    //! @}
 };
 
 }
@@ -181,10 +181,55 @@ public:
         m_maxAge = maxJacAge;
     }
 
+    //! Set options for the GMRES solver used when the SteadyStateSystem is solved
+    //! using a Jacobian-free Newton-Krylov method.
+    //! @param maxIter  Maximum number of GMRES iterations for each Newton step
+    //! @param rtol  Required reduction of the weighted norm of the preconditioned
+    //!     linear residual, relative to its initial value
+    //! @see SteadyStateSystem::setJacobianFree
+    //! @since New in %Cantera 3.2
+    void setKrylovOptions(size_t maxIter=50, double rtol=1e-4) {
+        m_krylovMaxIter = maxIter;
+        m_krylovRtol = rtol;
+    }
+
+    //! Total number of GMRES iterations taken since the last call to
+    //! clearKrylovStats().
+    //! @since New in %Cantera 3.2
+    int nKrylovIterations() const {
+        return m_krylovIters;
+    }
+
+    //! Number of GMRES solves that did not reach the required tolerance within the
+    //! maximum number of iterations since the last call to clearKrylovStats().
+    //! @since New in %Cantera 3.2
+    int nKrylovFailures() const {
+        return m_krylovFails;
+    }
+
+    //! Reset the GMRES iteration counters
+    //! @since New in %Cantera 3.2
+    void clearKrylovStats() {
+        m_krylovIters = 0;
+        m_krylovFails = 0;
+    }
+
     //! Change the problem size.
     void resize(size_t points);
 
 protected:
+    //! Solve the Newton system @f$ J \Delta x = -F(x) @f$ using left-preconditioned
+    //! GMRES, where products of the Jacobian with a vector @f$ v @f$ are approximated
+    //! as @f$ (F(x + \sigma v) - F(x)) / \sigma @f$ and the matrix held by the
+    //! SteadyStateSystem's linear solver is used as the preconditioner. The linear
+    //! residual is measured using the error weights of the SteadyStateSystem.
+    //! @param x  Current solution vector. Used as a work array but unchanged on return.
+    //! @param[in,out] step  On entry, the negative residual @f$ -F(x) @f$. On return,
+    //!     the undamped Newton step.
+    //! @param r  System being solved
+    //! @param loglevel  controls amount of printed diagnostics
+    void krylovStep(double* x, double* step, SteadyStateSystem& r, int loglevel);
+
     //! Work array holding the system state after the last successful step. Size #m_n.
     vector<double> m_x;
 
@@ -208,6 +253,17 @@ protected:
 
     //! Elapsed CPU time spent computing the Jacobian.
     double m_elapsed = 0.0;
+
+    size_t m_krylovMaxIter = 50; //!< Maximum number of GMRES iterations per step
+    double m_krylovRtol = 1e-4; //!< Relative tolerance for GMRES
+    int m_krylovIters = 0; //!< Number of GMRES iterations taken
+    int m_krylovFails = 0; //!< Number of GMRES solves that did not converge
+
+    //! Krylov basis vectors used by krylovStep()
+    vector<vector<double>> m_krylovBasis;
+
+    //! Work arrays used by krylovStep(). Size #m_n.
+    vector<double> m_krylovF, m_krylovWork, m_krylovEwt;
 };
 }
 
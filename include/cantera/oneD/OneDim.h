@@ -63,6 +63,7 @@ public:
     //! across all domains and @f$ J_d @f$ is the number of grid points in domain
     //! @f$ d @f$.
     double weightedNorm(const double* step) const override;
+    void getErrorWeights(double* ewt) const override;
 
     //! Return a reference to the Jacobian evaluator of an OneDim object.
     //! @deprecated To be removed after Cantera 3.2. Superseded by linearSolver()
@@ -173,8 +174,40 @@ public:
         return eval(npos, x, r, rdt, count);
     }
 
+    //! Evaluate the Jacobian used by the Newton solver.
+    //!
+    //! If the Jacobian-free Newton-Krylov method is being used (see
+    //! SteadyStateSystem::setJacobianFree()), only the diagonal blocks coupling the
+    //! components at each grid point are evaluated, and the resulting block-diagonal
+    //! matrix is used as the preconditioner. For Flow1D domains, the chemistry
+    //! contributions to these blocks can be computed from the analytic species
+    //! production rate derivatives (see Flow1D::setAnalyticChemistryJacobian()).
+    //! Using a sparse linear solver such as EigenSparseDirectJacobian avoids storing
+    //! the zero off-diagonal blocks.
     void evalJacobian(double* x0) override;
 
+    //! Enable or disable evaluation of the finite difference Jacobian using a
+    //! three-color partitioning of the grid.
+    //!
+    //! Since the residual at each grid point depends only on the solution at that
+    //! point and its immediate neighbors, the same solution component can be
+    //! perturbed at every third point simultaneously. This reduces the number of
+    //! residual evaluations per Jacobian from the total number of unknowns to
+    //! about three times the number of components per point, at the expense of
+    //! each evaluation covering the full grid. Unlike the default point-by-point
+    //! evaluation, transport properties are updated for each perturbed state.
+    //! @since New in %Cantera 3.2
+    void setColoredJacobian(bool colored) {
+        m_coloredJacobian = colored;
+    }
+
+    //! Returns `true` if the Jacobian is evaluated using grid coloring.
+    //! @see setColoredJacobian()
+    //! @since New in %Cantera 3.2
+    bool coloredJacobian() const {
+        return m_coloredJacobian;
+    }
+
     //! Return a pointer to the domain global point *i* belongs to.
     /*!
      * The domains are scanned right-to-left, and the first one with starting
@@ -205,6 +238,7 @@ public:
      * - number of non-Jacobian function evaluations
      * - CPU time spent evaluating functions
      * - number of time steps
+     * - number of GMRES iterations (Jacobian-free Newton-Krylov method only)
      */
     void saveStats();
 
@@ -249,6 +283,15 @@ public:
         return m_timeSteps;
     }
 
+    //! Return number of GMRES iterations taken in each call to solve() when using
+    //! the Jacobian-free Newton-Krylov method.
+    //! @see SteadyStateSystem::setJacobianFree
+    //! @since New in %Cantera 3.2
+    const vector<int>& krylovIterationStats() {
+        saveStats();
+        return m_krylovIters;
+    }
+
 protected:
     //! All domains comprising the system
     vector<shared_ptr<Domain1D>> m_dom;
@@ -277,6 +320,17 @@ protected:
     //! Total number of points.
     size_t m_pts = 0;
 
+    //! Evaluate the Jacobian by perturbing each component at each grid point
+    //! individually. Requires the unperturbed residual to be stored in #m_work1.
+    void evalJacobianColumns(double* x0);
+
+    //! Evaluate the Jacobian by perturbing every third grid point simultaneously.
+    //! Requires the unperturbed residual to be stored in #m_work1.
+    void evalColoredJacobian(double* x0);
+
+    //! Use grid coloring to evaluate the Jacobian. See setColoredJacobian()
+    bool m_coloredJacobian = false;
+
 private:
     //! @name Statistics
     //! Solver stats are collected after successfully solving on a particular grid.
@@ -300,6 +354,10 @@ private:
     //! successive grid refinement)
     vector<int> m_timeSteps;
 
+    //! Number of GMRES iterations taken on this grid when using the Jacobian-free
+    //! Newton-Krylov method
+    vector<int> m_krylovIters;
+
     //! @}
 };
 
@@ -34,6 +34,14 @@ namespace Cantera
  * values of Cp/R, H/RT, and S/R for all of the species at once at the specified
  * temperature.
  *
+ * Species using the standard NASA 7-coefficient (NasaPoly2) or NASA 9-coefficient
+ * (Nasa9PolyMultiTempRegion) parameterizations are not evaluated through individual
+ * virtual function calls. Instead, their coefficients are held in packed tables
+ * with a structure-of-arrays layout, which are evaluated for all species in
+ * branch-free loops that can be vectorized by the compiler. Results are identical
+ * to those of the individual species parameterizations. All other
+ * parameterizations use the general, per-species evaluation path.
+ *
  * Usually, all of the species in a phase are installed into a
  * MultiSpeciesThermo object. However, there is no requirement that a
  * MultiSpeciesThermo object handles all of the species in a phase. The member
@@ -96,6 +104,26 @@ public:
      */
     virtual void update(double T, double* cp_R, double* h_RT, double* s_R) const;
 
+    //! Compute the reference-state properties for all species using a workspace
+    //! provided by the caller.
+    /*!
+     * Results are identical to those of update(). As no internal work arrays are
+     * used and the packed coefficient tables are not rebuilt, this method can be
+     * called concurrently from multiple threads, provided that no other methods of
+     * this object are called at the same time. This includes update(), which
+     * rebuilds the packed tables after species were added or modified. Until then,
+     * this method uses the slower per-species evaluation.
+     *
+     * @param T       Temperature (Kelvin)
+     * @param cp_R    Vector of Dimensionless heat capacities. (length m_kk).
+     * @param h_RT    Vector of Dimensionless enthalpies. (length m_kk).
+     * @param s_R     Vector of Dimensionless entropies. (length m_kk).
+     * @param work    Work array, which is resized as needed
+     * @since New in %Cantera 3.2
+     */
+    void update(double T, double* cp_R, double* h_RT, double* s_R,
+                vector<double>& work) const;
+
     //! Minimum temperature.
     /*!
      * If no argument is supplied, this method returns the minimum temperature
@@ -190,9 +218,54 @@ protected:
     //! Mark species *k* as having its thermodynamic data installed
     void markInstalled(size_t k);
 
+    //! Packed coefficients of piecewise NASA polynomials
+    /*!
+     * Coefficients are stored in coefficient-major order, that is, coefficient `j`
+     * of temperature region `r` for packed entry `i` is located at
+     * `coeffs[(r * nCoeffs + j) * size() + i]`, and the lower temperature bound of
+     * region `r > 0` is located at `bounds[(r - 1) * size() + i]`. Species with fewer
+     * than #nRegions temperature regions are padded with regions that are never
+     * selected.
+     * @since New in %Cantera 3.2
+     */
+    struct PackedNasa
+    {
+        //! Number of packed species
+        size_t size() const {
+            return index.size();
+        }
+
+        //! Clear all entries and set the layout of the table
+        void reset(size_t nCoeffs_, size_t nRegions_, size_t n);
+
+        size_t nCoeffs = 0; //!< Number of coefficients per temperature region
+        size_t nRegions = 0; //!< Maximum number of temperature regions
+        vector<size_t> index; //!< Species index of each packed entry
+        vector<double> bounds; //!< Lower temperature bounds of regions `r > 0`
+        vector<double> coeffs; //!< Polynomial coefficients
+    };
+
+    //! Rebuild packed coefficient tables from installed species parameterizations.
+    //! Called by update() whenever species have been added or modified.
+    //! @since New in %Cantera 3.2
+    void packCoefficients() const;
+
+    //! Evaluate species using NASA 7-coefficient polynomials from #m_nasa7 and
+    //! scatter results into the output arrays. The work array *work* needs to hold
+    //! at least `3 * m_nasa7.size()` entries.
+    //! @since New in %Cantera 3.2
+    void updateNasa7(double T, double* cp_R, double* h_RT, double* s_R,
+                     double* work) const;
+
+    //! Evaluate species using NASA 9-coefficient polynomials from #m_nasa9 and
+    //! scatter results into the output arrays. The work array *work* needs to hold
+    //! at least `12 * m_nasa9.size()` entries.
+    //! @since New in %Cantera 3.2
+    void updateNasa9(double T, double* cp_R, double* h_RT, double* s_R,
+                     double* work) const;
+
     typedef pair<size_t, shared_ptr<SpeciesThermoInterpType>> index_STIT;
     typedef map<int, vector<index_STIT>> STIT_map;
-    typedef map<int, vector<double>> tpoly_map;
 
     //! This is the main data structure, which contains the
     //! SpeciesThermoInterpType objects, sorted by the parameterization type.
@@ -200,9 +273,6 @@ protected:
     //! parameterization `i`.
     STIT_map m_sp;
 
-    //! Temperature polynomials for each thermo parameterization
-    mutable tpoly_map m_tpoly;
-
     //! Map from species index to location within #m_sp, such that
     //! `m_sp[m_speciesLoc[k].first][m_speciesLoc[k].second]` is the
     //! SpeciesThermoInterpType object for species `k`.
@@ -219,6 +289,23 @@ protected:
 
     //! indicates if data for species has been installed
     vector<bool> m_installed;
+
+    //! Packed table for species using NasaPoly2. Entries are sorted by mid-point
+    //! temperature, such that at any temperature, species using their high- and
+    //! low-temperature coefficients each form a contiguous block.
+    mutable PackedNasa m_nasa7;
+
+    //! Packed table for species using Nasa9PolyMultiTempRegion
+    mutable PackedNasa m_nasa9;
+
+    //! Parameterization types that are evaluated using packed tables
+    mutable set<int> m_packedTypes;
+
+    //! Flag indicating whether packed tables need to be rebuilt
+    mutable bool m_packedStale = true;
+
+    //! Work array used by update()
+    mutable vector<double> m_work;
 };
 
 }
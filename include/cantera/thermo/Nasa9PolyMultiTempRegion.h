@@ -120,9 +120,6 @@ protected:
 
     //! Individual temperature region objects
     vector<unique_ptr<Nasa9Poly1>> m_regionPts;
-
-    //! current region
-    mutable int m_currRegion = 0;
 };
 
 }
@@ -95,6 +95,27 @@ shared_ptr<ThermoPhase> newThermo(const string& infile, const string& id="");
 void setupPhase(ThermoPhase& phase, const AnyMap& phaseNode,
                 const AnyMap& rootNode=AnyMap());
 
+//! Initialize a ThermoPhase object using the definition of an existing phase
+/*!
+ * The elements and species of *other* are added to *phase* without processing the
+ * species definitions again. The new Species objects share the transport data of
+ * the species of *other*, while species thermo objects are copied, such that
+ * changes like ThermoPhase::modifyOneHf298() only affect one of the phases; such
+ * changes made to *other* before calling this function are included. Phase-level
+ * model parameters are set from the input data of *other* (see ThermoPhase::input()),
+ * and the thermodynamic state of *other* is copied. Model parameters which were
+ * changed using methods of *other* after it was created are not copied.
+ *
+ * Phase models which require the root node of the input data for their setup,
+ * that is, LatticeSolidPhase and PlasmaPhase, are not supported.
+ *
+ *  @param phase  The ThermoPhase object to be initialized; this should be a newly
+ *     created object of the same type as *other*
+ *  @param other  The existing phase
+ * @since New in %Cantera 3.2
+ */
+void setupPhase(ThermoPhase& phase, const ThermoPhase& other);
+
 //! @}
 
 }
@@ -0,0 +1,104 @@
+/**
+ *  @file ApproxMixTransport.h
+ *    Headers for the ApproxMixTransport object, which models transport properties
+ *    in ideal gas solutions using mixture rules whose cost scales linearly with
+ *    the number of species
+ *    (see @ref tranprops and @link Cantera::ApproxMixTransport ApproxMixTransport @endlink) .
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_APPROXMIXTRAN_H
+#define CT_APPROXMIXTRAN_H
+
+#include "MixTransport.h"
+
+namespace Cantera
+{
+//! Class ApproxMixTransport implements mixture-averaged transport properties for
+//! ideal gas mixtures using approximate mixture rules intended for mechanisms with
+//! a large number of species.
+/*!
+ * The Wilke mixture rule used by MixTransport requires the weighting factors
+ * @f$ \Phi_{k,j} @f$ for all pairs of species, which are recomputed whenever the
+ * temperature changes. Since the weighting factors are multiplied by the mole
+ * fraction @f$ X_j @f$ in the denominator of the mixture rule, the sum over
+ * @f$ j @f$ is dominated by the small number of species with non-negligible mole
+ * fractions. This model truncates that sum to the set @f$ \mathcal{D} @f$ of
+ * dominant species, whose mole fraction is at least a given threshold
+ * (see setDominantSpeciesThreshold()), in the spirit of the truncated iterative
+ * methods of Ern and Giovangigli:
+ *
+ * @f[
+ *     \mu = \sum_k \frac{\mu_k X_k}{\sum_{j \in \mathcal{D}} \Phi_{k,j} X_j
+ *           + \left(1 - \sum_{j \in \mathcal{D}} X_j\right)}.
+ * @f]
+ *
+ * The last term in the denominator accounts for the remaining species by assuming
+ * @f$ \Phi_{k,j} = 1 @f$, which is exact for species with the same viscosity and
+ * molecular weight. The weighting factors are only evaluated for pairs involving
+ * a dominant species, so the cost scales as @f$ N N_\mathcal{D} @f$ instead of
+ * @f$ N^2 @f$ for a mechanism with @f$ N @f$ species.
+ *
+ * The thermal conductivity is computed using the combination-averaging rule of
+ * Mathur and Saxena, as in MixTransport, which already has a cost that scales
+ * linearly with the number of species. Species diffusion coefficients are the
+ * same as those of MixTransport.
+ *
+ * With the default threshold of 1e-4, the mixture viscosity differs from the
+ * value computed by MixTransport by less than 0.02% at all points of freely
+ * propagating hydrogen/air and methane/air flames (GRI 3.0, equivalence ratios
+ * from 0.7 to 1.5) and for equilibrium states of these mixtures at all mixture
+ * fractions, with up to 16 dominant species. A threshold of 1e-3 gives
+ * differences of up to 0.15%. Setting the threshold to zero recovers the Wilke
+ * mixture rule.
+ *
+ * This model can be specified in the YAML format by setting the `transport` field
+ * of the phase entry to `mixture-averaged-approximate` (or
+ * `mixture-averaged-approximate-CK` to use polynomial fits corresponding to
+ * Chemkin-II).
+ *
+ * @since New in %Cantera 3.2
+ * @ingroup tranprops
+ */
+class ApproxMixTransport : public MixTransport
+{
+public:
+    ApproxMixTransport() = default;
+
+    string transportModel() const override {
+        return (m_mode == CK_Mode) ? "mixture-averaged-approximate-CK"
+                                   : "mixture-averaged-approximate";
+    }
+
+    shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const override {
+        return copyTransport(*this, thermo);
+    }
+
+    //! Viscosity of the mixture (kg /m /s), computed using the truncated Wilke
+    //! mixture rule described in the class documentation.
+    double viscosity() override;
+
+    //! Set the mole fraction threshold above which a species is considered to be
+    //! one of the dominant species in the viscosity mixture rule. The species with
+    //! the largest mole fraction is always included. Default 1e-4.
+    void setDominantSpeciesThreshold(double threshold);
+
+    //! Get the mole fraction threshold defining the dominant species
+    double dominantSpeciesThreshold() const {
+        return m_threshold;
+    }
+
+protected:
+    //! Wilke weighting factor @f$ \Phi_{k,j} @f$ at the current temperature
+    double wilkeWeight(size_t k, size_t j) const;
+
+    //! Mole fraction threshold defining the dominant species
+    double m_threshold = 1e-4;
+
+    //! Indices of the dominant species for the current composition
+    vector<size_t> m_dominant;
+};
+}
+#endif
@@ -196,6 +196,18 @@ protected:
      */
     virtual void updateDiff_T();
 
+    //! Evaluate `n` of the polynomial fits stored in `coeffs` at the current
+    //! temperature, starting with the fit in row `start`.
+    /*!
+     * Each fit is evaluated as a polynomial in @f$ \ln T @f$ of degree 3
+     * (`CK_Mode`) or 4 and the results are stored in `out`, without applying the
+     * exponential or temperature factors associated with the fitted property.
+     *
+     * @since New in %Cantera 3.2
+     */
+    void evalPolynomialFits(const Array2D& coeffs, size_t start, size_t n,
+                            double* out) const;
+
     //! @name Initialization
     //! @{
 
@@ -335,10 +347,11 @@ protected:
     //! rule to calculate the viscosity of the solution. length = m_kk.
     vector<double> m_visc;
 
-    //! Polynomial fits to the viscosity of each species. m_visccoeffs[k] is
-    //! the vector of polynomial coefficients for species k that fits the
-    //! viscosity as a function of temperature.
-    vector<vector<double>> m_visccoeffs;
+    //! Polynomial fits to the viscosity of each species. Row `k` of
+    //! m_visccoeffs contains the polynomial coefficients for species k that fit
+    //! the viscosity as a function of temperature. Coefficients of the same order
+    //! are stored contiguously for all species (one column per order).
+    Array2D m_visccoeffs;
 
     //! Local copy of the species molecular weights.
     vector<double> m_mw;
@@ -384,8 +397,9 @@ protected:
 
     //! Polynomial fits to the binary diffusivity of each species
     /*!
-     * m_diffcoeff[ic] is vector of polynomial coefficients for species i
-     * species j that fits the binary diffusion coefficient. The relationship
+     * Row `ic` of m_diffcoeffs contains the polynomial coefficients for species
+     * i and species j that fit the binary diffusion coefficient, with one column
+     * for each polynomial order. The relationship
      * between i j and ic is determined from the following algorithm:
      *
      *      int ic = 0;
@@ -395,7 +409,7 @@ protected:
      *         }
      *      }
      */
-    vector<vector<double>> m_diffcoeffs;
+    Array2D m_diffcoeffs;
 
     //! Matrix of binary diffusion coefficients at the reference pressure and
     //! the current temperature Size is nsp x nsp.
@@ -403,10 +417,10 @@ protected:
 
     //! temperature fits of the heat conduction
     /*!
-     *  Dimensions are number of species (nsp) polynomial order of the collision
-     *  integral fit (degree+1).
+     *  Dimensions are number of species (nsp) by the number of polynomial
+     *  coefficients (degree+1), with one column for each polynomial order.
      */
-    vector<vector<double>> m_condcoeffs;
+    Array2D m_condcoeffs;
 
     //! Indices for the (i,j) interaction in collision integral fits
     /*!
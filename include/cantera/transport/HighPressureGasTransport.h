@@ -162,6 +162,10 @@ public:
         return "high-pressure";
     }
 
+    shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const override {
+        return copyTransport(*this, thermo);
+    }
+
     void init(ThermoPhase* thermo, int mode=0) override;
 
     /**
@@ -840,6 +844,10 @@ public:
         return "high-pressure-Chung";
     }
 
+    shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const override {
+        return copyTransport(*this, thermo);
+    }
+
     void init(ThermoPhase* thermo, int mode=0) override;
 
     /**
@@ -40,6 +40,10 @@ public:
         return "ionized-gas";
     }
 
+    shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const override {
+        return copyTransport(*this, thermo);
+    }
+
     void init(ThermoPhase* thermo, int mode) override;
 
     //! Viscosity of the mixture  (kg/m/s).
@@ -61,6 +61,10 @@ public:
         return (m_mode == CK_Mode) ? "mixture-averaged-CK" : "mixture-averaged";
     }
 
+    shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const override {
+        return copyTransport(*this, thermo);
+    }
+
     //! Return the thermal diffusion coefficients
     /*!
      * For this approximation, these are all zero.
@@ -20,6 +20,15 @@ namespace Cantera
  * The implementation generally follows the procedure outlined in Kee, et al.
  * @cite kee2003.
  *
+ * By default, the linear systems defining the thermal conductivity, thermal
+ * diffusion coefficients and diffusive fluxes are solved using a dense LU
+ * factorization, with a cost that scales as @f$ N^3 @f$ for @f$ N @f$ species.
+ * Alternatively, these systems can be solved iteratively (see
+ * setIterativeSolver()), with a cost per iteration that scales as @f$ N^2 @f$.
+ * This model can be specified in the YAML format by setting the `transport` field
+ * of the phase entry to `multicomponent-iterative` (or
+ * `multicomponent-iterative-CK`).
+ *
  * @ingroup tranprops
  */
 class MultiTransport : public GasTransport
@@ -29,9 +38,89 @@ public:
     MultiTransport() = default;
 
     string transportModel() const override {
+        if (m_iterative) {
+            return (m_mode == CK_Mode) ? "multicomponent-iterative-CK"
+                                       : "multicomponent-iterative";
+        }
         return (m_mode == CK_Mode) ? "multicomponent-CK" : "multicomponent";
     }
 
+    shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const override {
+        return copyTransport(*this, thermo);
+    }
+
+    //! Set whether to use an iterative solver for the L matrix equation and the
+    //! Stefan-Maxwell equations.
+    /*!
+     * The symmetric structure of these systems is exploited by solving them with
+     * the conjugate gradient method, using a diagonal preconditioner. The solution
+     * for the previous state is used as the initial guess, so only a few
+     * iterations are needed if the state changes only slightly between calls. The
+     * multicomponent diffusion coefficients returned by getMultiDiffCoeffs() are
+     * always computed by direct inversion.
+     *
+     * @param iterative  `true` to use the iterative solver; `false` to use the
+     *     direct solver (default)
+     * @param rtol  Relative tolerance on the residual norm
+     * @since New in %Cantera 3.2
+     */
+    void setIterativeSolver(bool iterative, double rtol=1e-12);
+
+    //! Return `true` if the iterative solver is used
+    //! @since New in %Cantera 3.2
+    bool iterativeSolver() const {
+        return m_iterative;
+    }
+
+    //! Number of iterations used in the last iterative solution of the L matrix
+    //! equation
+    //! @since New in %Cantera 3.2
+    size_t lastIterationCount() const {
+        return m_lastIterations;
+    }
+
+    //! Get the coefficients of the Stefan-Maxwell equations at the current state.
+    /*!
+     * The diffusion velocities @f$ V_k @f$ satisfy the Stefan-Maxwell equations
+     * (neglecting thermal diffusion)
+     * @f[
+     *     \sum_{j \ne i} S_{ij} (V_j - V_i) = p \nabla X_i, \qquad
+     *     \sum_j v_j V_j = 0
+     * @f]
+     * where @f$ S_{ij} = X_i X_j / \mathcal{D}_{ij} @f$, with the binary diffusion
+     * coefficients evaluated at unit pressure, and @f$ v_j = X_j M_j / \bar{M} @f$
+     * are the mass fractions. The diffusive mass fluxes are then
+     * @f$ j_k = \rho v_k V_k / p @f$. To avoid singular equations, mole fractions
+     * are bounded below by a small positive number when computing
+     * @f$ S_{ij} @f$ and @f$ v_j @f$. These equations can be solved using
+     * solveStefanMaxwell().
+     *
+     * @param ld  Leading dimension of `S`
+     * @param[out] S  Symmetric matrix @f$ S_{ij} @f$; the diagonal is set to zero
+     * @param[out] v  Constraint weights @f$ v_j @f$. Length m_nsp.
+     * @since New in %Cantera 3.2
+     */
+    void getStefanMaxwellSystem(size_t ld, double* S, double* v);
+
+    //! Solve the Stefan-Maxwell equations defined by `S` and `v`, as described in
+    //! getStefanMaxwellSystem(), using the conjugate gradient method.
+    /*!
+     * @param n  Number of species
+     * @param S  Symmetric matrix with non-negative entries and leading dimension
+     *     `ld`. The diagonal is not used.
+     * @param ld  Leading dimension of `S`
+     * @param v  Constraint weights, length `n`
+     * @param b  Right-hand side, length `n`. The component along the vector of ones
+     *     (which should be zero) is removed.
+     * @param[in,out] z  On input, the initial guess. On output, the solution.
+     * @param rtol  Relative tolerance on the residual norm
+     * @returns  The number of iterations taken
+     * @since New in %Cantera 3.2
+     */
+    static size_t solveStefanMaxwell(size_t n, const double* S, size_t ld,
+                                     const double* v, const double* b, double* z,
+                                     double rtol=1e-12);
+
     //! Return the thermal diffusion coefficients (kg/m/s)
     /*!
      * Eqn. (12.126) of Kee et al. @cite kee2003 displays how they are calculated. The
@@ -180,7 +269,21 @@ protected:
     double pressure_ig();
 
     virtual void solveLMatrixEquation();
+
+    //! Solve the L matrix equation iteratively, after evaluating the L matrix
+    //! with the symmetric form of the L00,00 block.
+    void solveLMatrixIterative();
+
     bool m_debug;
+
+    //! Use the iterative solver
+    bool m_iterative = false;
+
+    //! Relative tolerance for the iterative solver
+    double m_iterativeRtol = 1e-12;
+
+    //! Number of iterations taken by the last iterative L matrix solution
+    size_t m_lastIterations = 0;
 };
 }
 #endif
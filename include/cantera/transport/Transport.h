@@ -82,8 +82,7 @@ public:
 
     virtual ~Transport() {}
 
-    // Transport objects are not copyable or assignable
-    Transport(const Transport&) = delete;
+    // Transport objects are not assignable
     Transport& operator=(const Transport&) = delete;
 
     //! Identifies the model represented by this Transport object. Each derived class
@@ -415,6 +414,18 @@ public:
      */
     virtual void init(ThermoPhase* thermo, int mode=0) {}
 
+    //! Create a new Transport object of the same type for the phase *thermo*
+    /*!
+     * The new object is independent of this one, but species transport parameters
+     * and fitted collision integrals and property polynomials are copied instead of
+     * being computed again. *thermo* must contain the same species as the phase
+     * used by this object, for example because it was created by
+     * Solution::clone(). Models which do not implement this method are
+     * initialized from scratch.
+     * @since New in %Cantera 3.2
+     */
+    virtual shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const;
+
     //! Boolean indicating the form of the transport properties polynomial fits.
     //! Returns true if the Chemkin form is used.
     virtual bool CKMode() const {
@@ -430,6 +441,28 @@ public:
     virtual void invalidateCache() {}
 
 protected:
+    //! Copy constructor, which is only used by derived classes to implement clone()
+    Transport(const Transport&) = default;
+
+    //! Create a copy of *other*, which is an object of derived type *T*, for use
+    //! with the phase *thermo*. Used by derived classes to implement clone().
+    //! Objects of classes derived from *T* are initialized from scratch instead.
+    template <class T>
+    static shared_ptr<Transport> copyTransport(const T& other,
+                                               shared_ptr<ThermoPhase> thermo)
+    {
+        if (typeid(other) != typeid(T)) {
+            return other.Transport::clone(thermo);
+        }
+        other.checkClone(*thermo);
+        auto tr = make_shared<T>(other);
+        tr->m_thermo = thermo.get();
+        return tr;
+    }
+
+    //! Check that *thermo* can be used by a copy of this object
+    void checkClone(const ThermoPhase& thermo) const;
+
     //! pointer to the object representing the phase
     ThermoPhase* m_thermo;
 
@@ -31,6 +31,10 @@ public:
         return "unity-Lewis-number";
     }
 
+    shared_ptr<Transport> clone(shared_ptr<ThermoPhase> thermo) const override {
+        return copyTransport(*this, thermo);
+    }
+
     //! Returns the unity Lewis number approximation based diffusion
     //! coefficients [m^2/s].
     /*!
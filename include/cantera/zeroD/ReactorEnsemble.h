@@ -0,0 +1,116 @@
+//! @file ReactorEnsemble.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORENSEMBLE_H
+#define CT_REACTORENSEMBLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class Reactor;
+class ReactorNet;
+class Solution;
+class SolutionArray;
+class ThreadPool;
+
+//! Integrate many independent reactors, each starting from a different initial
+//! state, for example to compute ignition delay times for a parameter sweep.
+/*!
+ * Each thread used by the ensemble owns a single Solution, Reactor, and ReactorNet,
+ * which are created once and then reused for every case assigned to that thread.
+ * Cases are handed out to the threads dynamically, so threads that finish cheap
+ * cases early continue with the remaining ones. The results for each case do not
+ * depend on the thread or the number of threads used to compute them.
+ *
+ * @code
+ * ReactorEnsemble ensemble("gri30.yaml", "gri30");
+ * ensemble.setNumThreads(4);
+ * auto initial = SolutionArray::create(newSolution("gri30.yaml", "gri30", "none"));
+ * // ... fill 'initial' with the initial states ...
+ * auto results = ensemble.integrate(*initial);
+ * auto tau = results->getComponent("ignition-delay");
+ * @endcode
+ *
+ * @since New in %Cantera 3.2
+ * @ingroup zerodGroup
+ */
+class ReactorEnsemble
+{
+public:
+    //! Create an ensemble for the specified phase definition
+    //! @param infile  Name of the input file containing the phase definition
+    //! @param name  Name of the phase in the input file. If empty, the first phase
+    //!     definition is used.
+    //! @param reactorType  Type of reactor created for each thread, as accepted by
+    //!     newReactor4()
+    ReactorEnsemble(const string& infile, const string& name="",
+                    const string& reactorType="IdealGasConstPressureReactor");
+    ~ReactorEnsemble();
+    ReactorEnsemble(const ReactorEnsemble&) = delete;
+    ReactorEnsemble& operator=(const ReactorEnsemble&) = delete;
+
+    //! Set the number of threads used to integrate the cases.
+    //! @param nThreads  Number of threads, including the calling thread. If zero,
+    //!     the number of hardware threads is used.
+    void setNumThreads(size_t nThreads);
+
+    //! Number of threads used to integrate the cases
+    size_t numThreads() const;
+
+    //! Set the relative and absolute integration tolerances used for each case.
+    //! Negative values leave the ReactorNet defaults unchanged.
+    void setTolerances(double rtol, double atol);
+
+    //! Set the time up to which each case is integrated [s]. Default 0.1 s.
+    void setEndTime(double tEnd) {
+        m_tEnd = tEnd;
+    }
+
+    //! Set the temperature increase over the initial temperature [K] used to
+    //! define the ignition delay time. Default 400 K.
+    void setIgnitionTemperatureRise(double deltaT) {
+        m_deltaT = deltaT;
+    }
+
+    //! Integrate each state in `initial` from @f$ t = 0 @f$ to the end time.
+    //!
+    //! @param initial  Initial states, one per case
+    //! @returns  A SolutionArray containing the state of each case at the end time,
+    //!     with the additional components
+    //!     - `ignition-delay`: time at which the temperature first exceeds the
+    //!       initial temperature by the ignition temperature rise, interpolated
+    //!       linearly between integrator steps; `NaN` if no ignition occurred
+    //!     - one component for each integer counter reported by
+    //!       ReactorNet::solverStats(), for example `steps`
+    shared_ptr<SolutionArray> integrate(SolutionArray& initial);
+
+protected:
+    //! Objects used by each thread
+    struct Worker {
+        shared_ptr<Solution> solution;
+        shared_ptr<Reactor> reactor;
+        shared_ptr<ReactorNet> net;
+    };
+
+    //! Create missing Worker objects, one for each thread
+    void updateWorkers();
+
+    string m_infile; //!< Input file containing the phase definition
+    string m_phaseName; //!< Name of the phase definition
+    string m_reactorType; //!< Type of reactor used for each case
+    double m_rtol = -1.0; //!< Relative tolerance; negative to use default
+    double m_atol = -1.0; //!< Absolute tolerance; negative to use default
+    double m_tEnd = 0.1; //!< End time of each integration [s]
+    double m_deltaT = 400.0; //!< Temperature rise defining ignition [K]
+
+    unique_ptr<ThreadPool> m_pool; //!< Thread pool; `nullptr` for serial integration
+    vector<Worker> m_workers; //!< Objects owned by each thread
+};
+
+}
+
+#endif
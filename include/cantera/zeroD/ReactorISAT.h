@@ -0,0 +1,183 @@
+//! @file ReactorISAT.h
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#ifndef CT_REACTORISAT_H
+#define CT_REACTORISAT_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/AnyMap.h"
+#include <list>
+
+namespace Cantera
+{
+
+class Reactor;
+class ReactorNet;
+class Solution;
+
+//! In situ adaptive tabulation (ISAT) of the reaction mapping of a constant pressure
+//! ideal gas reactor.
+/*!
+ * The reaction mapping @f$ R(\phi, \Delta t) @f$ gives the composition
+ * @f$ \phi = (T, Y_1, \ldots, Y_K) @f$ of an adiabatic, constant pressure reactor
+ * after a time @f$ \Delta t @f$, starting from the composition @f$ \phi @f$. This
+ * mapping is needed, for example, by operator-split CFD solvers, where it is
+ * evaluated for every cell and time step. ISAT [Pope, Combust. Theory Modelling
+ * 1:41-63, 1997] stores the mapping for previously integrated initial states in
+ * records containing
+ *
+ * - the initial state @f$ \phi_0 @f$ and time step @f$ \Delta t_0 @f$,
+ * - the mapped state @f$ R_0 = R(\phi_0, \Delta t_0) @f$,
+ * - the mapping gradient @f$ A @f$, which is the derivative of @f$ R @f$ with
+ *   respect to @f$ \phi_0 @f$ and @f$ \Delta t_0 @f$, and
+ * - an ellipsoid of accuracy (EOA), the region of @f$ (\phi, \Delta t) @f$ where
+ *   the linear approximation @f$ R \approx R_0 + A \, \delta @f$ is expected to
+ *   have an error less than the specified tolerance.
+ *
+ * For each query, the binary tree of records is traversed to find the record whose
+ * initial state is closest to the query point. The query is then handled in one of
+ * the following ways:
+ *
+ * - *retrieve*: If the query point is inside the EOA of the record, the linear
+ *   approximation is returned.
+ * - *grow*: Otherwise, the reactor is integrated directly. If the error of the
+ *   linear approximation is within the tolerance, the EOA is grown to include the
+ *   query point.
+ * - *add*: Otherwise, a new record is created for the query point from the result
+ *   of the same direct integration.
+ *
+ * The mapping gradient is computed while integrating the reactor, by multiplying
+ * the linearized backward Euler propagators @f$ (I - h_n J_n)^{-1} @f$ for each
+ * integrator step @f$ h_n @f$, where @f$ J_n @f$ is the sparse Jacobian of
+ * IdealGasConstPressureMoleReactor at the end of the step.
+ *
+ * Errors are measured using the scaled variables @f$ T/T_s @f$ and @f$ Y_k @f$,
+ * where @f$ T_s @f$ is set using setTemperatureScale(). The time step is scaled by
+ * the time step used to create the first record. When the number of records exceeds
+ * the limit set with setMaxRecords(), the least recently used record is removed. The
+ * memory required for each record is approximately @f$ 16 (K+2)^2 @f$ bytes.
+ *
+ * The table is only valid for a single pressure, which is taken from the first
+ * query. Queries at a different pressure clear the table.
+ *
+ * @code
+ * auto gas = newSolution("gri30.yaml", "gri30", "none");
+ * ReactorISAT isat(gas);
+ * isat.setTolerance(1e-4);
+ * for (auto& cell : cells) {
+ *     gas->thermo()->setState_TPY(cell.T, P, cell.Y);
+ *     isat.advance(dt);
+ *     cell.T = gas->thermo()->temperature();
+ *     gas->thermo()->getMassFractions(cell.Y);
+ * }
+ * AnyMap stats = isat.stats(); // for example, stats["hit-rate"]
+ * @endcode
+ *
+ * @since New in %Cantera 3.2
+ * @ingroup zerodGroup
+ */
+class ReactorISAT
+{
+public:
+    //! Create a table for the specified ideal gas phase. The state of the phase is
+    //! used to pass the query point and the result of each query.
+    explicit ReactorISAT(shared_ptr<Solution> sol);
+    ~ReactorISAT();
+    ReactorISAT(const ReactorISAT&) = delete;
+    ReactorISAT& operator=(const ReactorISAT&) = delete;
+
+    //! The reactor network used to integrate the reactor directly. Can be used to set
+    //! integrator tolerances.
+    ReactorNet& reactorNet() {
+        return *m_net;
+    }
+
+    //! Set the error tolerance for the linear approximations. Default 1e-4.
+    void setTolerance(double tol);
+
+    //! Error tolerance for the linear approximations
+    double tolerance() const {
+        return m_tol;
+    }
+
+    //! Set the temperature used to scale temperature differences [K]. Default 1000 K.
+    void setTemperatureScale(double T);
+
+    //! Set the maximum number of records. Default 1000.
+    void setMaxRecords(size_t n);
+
+    //! Maximum number of records
+    size_t maxRecords() const {
+        return m_maxRecords;
+    }
+
+    //! Number of records currently in the table
+    size_t nRecords() const {
+        return m_lru.size();
+    }
+
+    //! Advance the state of the phase by the time step `dt` [s], using the table if
+    //! possible, and set the phase to the resulting state.
+    void advance(double dt);
+
+    //! Remove all records from the table. Statistics are not reset.
+    void clear();
+
+    //! Get statistics on the use of the table. Contains the number of `queries`,
+    //! `retrieves`, `grows`, `adds`, `evictions`, and `direct-integrations`, the
+    //! current number of `records`, and the `hit-rate`, which is the fraction of
+    //! queries resolved by retrieving a linear approximation.
+    AnyMap stats() const;
+
+protected:
+    struct Record;
+    struct Node;
+
+    //! Integrate the reactor from the initial state `phi` (the scaled temperature,
+    //! mass fractions, and time step) and store the scaled result in `out`. The
+    //! mapping gradient and the initial ellipsoid of accuracy are stored in `record`.
+    void integrate(const double* phi, double* out, Record& record);
+
+    //! Find the leaf of the binary tree for the scaled query point `phi`
+    Node* findLeaf(const double* phi) const;
+
+    //! Insert a record into the tree, splitting the leaf `leaf` if it is not null
+    void insert(Node* leaf, unique_ptr<Record> record);
+
+    //! Remove the least recently used record
+    void evict();
+
+    //! Mark `record` as the most recently used record
+    void touch(Record* record);
+
+    shared_ptr<Solution> m_solution; //!< Contents of the reactor
+    shared_ptr<Reactor> m_reactor; //!< Reactor used for direct integration
+    shared_ptr<ReactorNet> m_net; //!< Network used for direct integration
+    size_t m_nsp; //!< Number of species
+    size_t m_nin; //!< Number of tabulated input variables (T, Y, dt)
+
+    double m_tol = 1e-4; //!< Error tolerance
+    double m_Tscale = 1000.0; //!< Temperature scale [K]
+    double m_dtScale = 0.0; //!< Time step scale [s]; set by the first record
+    double m_pressure = 0.0; //!< Pressure of the tabulated states [Pa]
+    size_t m_maxRecords = 1000; //!< Maximum number of records
+
+    unique_ptr<Node> m_root; //!< Root of the binary tree
+    std::list<Record*> m_lru; //!< Records, from most to least recently used
+
+    //! @name Statistics
+    //! @{
+    long int m_nQueries = 0;
+    long int m_nRetrieves = 0;
+    long int m_nGrows = 0;
+    long int m_nAdds = 0;
+    long int m_nEvictions = 0;
+    long int m_nDirect = 0;
+    //! @}
+};
+
+}
+
+#endif
@@ -16,6 +16,7 @@ namespace Cantera
 class Array2D;
 class Integrator;
 class SystemJacobian;
+class ThreadPool;
 
 //! A class representing a network of connected reactors.
 /*!
@@ -52,6 +53,30 @@ public:
     //! @param preconditioner preconditioner object used for the linear solver
     void setPreconditioner(shared_ptr<SystemJacobian> preconditioner);
 
+    //! Set the policy for reusing Jacobian data when updating the preconditioner.
+    /*!
+     * By default, the Jacobians of all reactors are re-evaluated whenever the
+     * integrator requests a preconditioner update with new Jacobian data. If reuse is
+     * enabled, the preconditioner @f$ M = I - \gamma J @f$ is instead formed from the
+     * previously evaluated Jacobian and the new value of @f$ \gamma @f$, as long as
+     *
+     * - the Jacobian has been reused fewer than *maxAge* times (see
+     *   SystemJacobian::age()), and
+     * - the relative change of @f$ \gamma @f$ since the Jacobian was evaluated
+     *   does not exceed *maxGammaChange*.
+     *
+     * The integrator is informed that the Jacobian data was not re-evaluated, which
+     * allows it to request a new Jacobian if the nonlinear iterations fail to
+     * converge. Such repeated requests at the same time always lead to
+     * re-evaluation, as does re-initialization of the integrator.
+     *
+     * @param maxAge  Maximum number of consecutive reuses of a Jacobian. A value of
+     *     zero (default) disables reuse.
+     * @param maxGammaChange  Maximum relative change of @f$ \gamma @f$
+     * @since New in %Cantera 3.2
+     */
+    void setPreconditionerReuse(int maxAge, double maxGammaChange=0.3);
+
     //! Set the initial value of the independent variable (typically time).
     //! Default = 0.0 s. Restarts integration from this value using the current mixture
     //! state as the initial condition.
@@ -352,10 +377,33 @@ public:
     //! Retrieve absolute step size limits during advance
     bool getAdvanceLimits(double* limits) const;
 
+    //! Set the number of threads used to evaluate the governing equations of the
+    //! reactors in the network.
+    //!
+    //! Each reactor is evaluated by a single thread, and the results are identical
+    //! to those obtained with serial evaluation. Updating the state of the reactors
+    //! and connected devices is always done by the calling thread. Parallel evaluation
+    //! requires that the reactors (and their surfaces) do not share ThermoPhase
+    //! objects; otherwise, the reactors are evaluated serially.
+    //!
+    //! @param nThreads  Number of threads, including the calling thread. If zero,
+    //!     the number of hardware threads is used.
+    //! @since New in %Cantera 3.2
+    void setNumThreads(size_t nThreads);
+
+    //! Number of threads used to evaluate the reactors in the network.
+    //! @see setNumThreads
+    //! @since New in %Cantera 3.2
+    size_t numThreads() const;
+
     void preconditionerSetup(double t, double* y, double gamma) override;
 
     void preconditionerSolve(double* rhs, double* output) override;
 
+    bool preconditionerJacobianCurrent() const override {
+        return m_preconJacobianCurrent;
+    }
+
     //! Get solver stats from integrator
     AnyMap solverStats() const;
 
@@ -371,6 +419,10 @@ protected:
     //! Check that preconditioning is supported by all reactors in the network
     virtual void checkPreconditionerSupported() const;
 
+    //! Call `func(n)` for each reactor `n` in the network, in parallel if
+    //! setNumThreads() has been used and the reactors can be evaluated independently.
+    void forEachReactor(const std::function<void(size_t)>& func);
+
     void updatePreconditioner(double gamma) override;
 
     //! Create reproducible names for reactors and walls/connectors.
@@ -412,6 +464,17 @@ protected:
     shared_ptr<SystemJacobian> m_precon;
     string m_linearSolverType;
 
+    //! @name Reuse of Jacobian data for the preconditioner
+    //! @see setPreconditionerReuse
+    //! @{
+    int m_preconMaxAge = 0; //!< Maximum number of consecutive reuses
+    double m_preconMaxGammaChange = 0.3; //!< Maximum relative change of gamma
+    double m_preconGamma = NAN; //!< Value of gamma when the Jacobian was evaluated
+    double m_preconReuseTime = NAN; //!< Time of the last update reusing the Jacobian
+    //! `false` if the last preconditioner setup reused the Jacobian
+    bool m_preconJacobianCurrent = true;
+    //! @}
+
     //! Maximum integrator internal timestep. Default of 0.0 means infinity.
     double m_maxstep = 0.0;
 
@@ -430,6 +493,13 @@ protected:
     //! "left hand side" of each governing equation
     vector<double> m_LHS;
     vector<double> m_RHS;
+
+    //! Thread pool used for parallel evaluation of reactors. See setNumThreads()
+    unique_ptr<ThreadPool> m_pool;
+
+    //! `true` if no ThermoPhase objects are shared between reactors, allowing them
+    //! to be evaluated in parallel. Determined by initialize().
+    bool m_independentReactors = false;
 };
 
 
@@ -445,6 +515,7 @@ public:
     void initTimeInteg(double dt, double* x) override;
     void evalJacobian(double* x0) override;
     double weightedNorm(const double* step) const override;
+    void getErrorWeights(double* ewt) const override;
     string componentName(size_t i) const override;
     double upperBound(size_t i) const override;
     double lowerBound(size_t i) const override;
@@ -0,0 +1,129 @@
+/*
+ * Benchmark batched kinetics evaluations
+ * ======================================
+ *
+ * Compare the evaluation of net production rates for many thermodynamic states, as
+ * required for chemical source terms in CFD simulations, using a loop over individual
+ * states (``setState_TPY`` followed by ``getNetProductionRates``) with a single call
+ * to ``Kinetics::getNetProductionRatesBatch``. As the batched evaluation does not
+ * modify the phase or the kinetics object, states can also be distributed across
+ * several threads that share the same ``Kinetics`` object. Mechanisms and the number
+ * of states can be specified on the command line as
+ * ``batch_speed [n_states] [mechanism.yaml[:phase] ...]``.
+ *
+ * .. tags:: C++, kinetics, parallel computing, benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "cantera/core.h"
+
+using namespace Cantera;
+
+//! Return the time in seconds per call of `eval`, using the best of several runs
+template <class Function>
+double timeit(Function eval, size_t runs=7)
+{
+    double best = 1e300;
+    for (size_t run = 0; run < runs; ++run) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        eval();
+        auto t2 = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t2 - t1).count());
+    }
+    return best;
+}
+
+void benchmark(const string& mech, const string& phase, size_t n)
+{
+    auto sol = newSolution(mech, phase, "none");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    size_t nsp = gas->nSpecies();
+    std::cout << mech << ": " << nsp << " species, " << kin->nReactions()
+        << " reactions, " << n << " states" << std::endl;
+
+    // States of a partially reacted mixture for a range of temperatures and pressures
+    vector<double> T(n), P(n), Y(n * nsp), wdot(n * nsp);
+    vector<double> X(nsp);
+    size_t kFuel = (gas->speciesIndex("CH4") != npos) ? gas->speciesIndex("CH4")
+                                                        : gas->speciesIndex("H2");
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 1000. + 1000. * i / n;
+        P[i] = OneAtm * (1. + 19. * (i % 17) / 17.);
+        for (size_t k = 0; k < nsp; k++) {
+            X[k] = 1e-4 * (1 + (i + k) % 5);
+        }
+        X[gas->speciesIndex("O2")] = 0.2;
+        X[gas->speciesIndex("N2")] = 0.7;
+        if (kFuel != npos) {
+            X[kFuel] = 0.05;
+        }
+        gas->setState_TPX(T[i], P[i], X.data());
+        gas->getMassFractions(&Y[i * nsp]);
+    }
+
+    double loop = timeit([&]() {
+        for (size_t i = 0; i < n; i++) {
+            gas->setState_TPY(T[i], P[i], &Y[i * nsp]);
+            kin->getNetProductionRates(&wdot[i * nsp]);
+        }
+    });
+    std::cout << std::setprecision(4)
+        << "  loop over states:  " << 1e6 * loop / n << " μs per state" << std::endl;
+
+    double batch = timeit([&]() {
+        kin->getNetProductionRatesBatch(n, T.data(), P.data(), Y.data(), wdot.data());
+    });
+    std::cout << "  batched:           " << 1e6 * batch / n << " μs per state ("
+        << loop / batch << "x)" << std::endl;
+
+    size_t nThreads = std::thread::hardware_concurrency();
+    if (nThreads > 1) {
+        double threaded = timeit([&]() {
+            vector<std::thread> threads;
+            size_t chunk = (n + nThreads - 1) / nThreads;
+            for (size_t start = 0; start < n; start += chunk) {
+                size_t m = std::min(chunk, n - start);
+                threads.emplace_back([&, start, m]() {
+                    kin->getNetProductionRatesBatch(m, &T[start], &P[start],
+                        &Y[start * nsp], &wdot[start * nsp]);
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        });
+        std::cout << "  batched, " << nThreads << " threads: " << 1e6 * threaded / n
+            << " μs per state (" << loop / threaded << "x)" << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t n = 1000;
+    if (argc > 1) {
+        n = std::stoul(argv[1]);
+    }
+    std::cout << "Benchmark tests for batched net production rates." << std::endl;
+    std::cout << std::endl;
+    benchmark("gri30.yaml", "gri30", n);
+    std::cout << std::endl;
+    benchmark("nDodecane_Reitz.yaml", "nDodecane_IG", n);
+    for (int i = 2; i < argc; i++) {
+        string arg = argv[i];
+        size_t colon = arg.rfind(':');
+        std::cout << std::endl;
+        if (colon == string::npos) {
+            benchmark(arg, "", n);
+        } else {
+            benchmark(arg.substr(0, colon), arg.substr(colon + 1), n);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Benchmark ensemble ignition delay calculations
+ * ==============================================
+ *
+ * Compute ignition delay times for a sweep over initial temperature, pressure, and
+ * equivalence ratio using ``ReactorEnsemble``, and report the number of cases
+ * integrated per second for increasing numbers of threads. The mechanism and the
+ * number of cases can be specified on the command line as
+ * ``ensemble_speed [mechanism.yaml[:phase] [fuel] [n_cases]]``.
+ *
+ * .. tags:: C++, combustion, reactor network, ignition delay, parallel computing,
+ *           benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include "cantera/zerodim.h"
+#include "cantera/base/SolutionArray.h"
+
+using namespace Cantera;
+
+void benchmark(const string& mech, const string& phase, const string& fuel,
+               size_t nCases)
+{
+    auto sol = newSolution(mech, phase, "none");
+    auto gas = sol->thermo();
+
+    // Sweep over temperature, pressure, and equivalence ratio
+    auto initial = SolutionArray::create(sol, static_cast<int>(nCases));
+    vector<double> state(gas->stateSize());
+    size_t n = static_cast<size_t>(std::ceil(std::cbrt(nCases)));
+    for (size_t i = 0; i < nCases; i++) {
+        double T = 1000.0 + 500.0 * (i % n) / n;
+        double P = OneAtm * (1.0 + 19.0 * ((i / n) % n) / n);
+        double phi = 0.5 + 1.5 * (i / (n * n)) / n;
+        gas->setState_TP(T, P);
+        gas->setEquivalenceRatio(phi, fuel + ":1.0", "O2:1.0, N2:3.76");
+        gas->saveState(state);
+        initial->setState(static_cast<int>(i), state);
+    }
+
+    std::cout << mech << ": " << nCases << " cases" << std::endl;
+    std::cout << "threads     time (s)    cases/s    speedup" << std::endl;
+    ReactorEnsemble ensemble(mech, phase);
+    ensemble.setEndTime(0.1);
+    size_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    double baseline = 0.0;
+    for (size_t nThreads = 1; ; nThreads = std::min(2 * nThreads, maxThreads)) {
+        ensemble.setNumThreads(nThreads);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        auto results = ensemble.integrate(*initial);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        double elapsed = std::chrono::duration<double>(t2 - t1).count();
+        double rate = nCases / elapsed;
+        if (nThreads == 1) {
+            baseline = rate;
+        }
+        std::cout << fmt::format("{:7d} {:12.3f} {:10.1f} {:10.2f}",
+                                 nThreads, elapsed, rate, rate / baseline)
+                  << std::endl;
+        if (nThreads == maxThreads) {
+            break;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    string mech = "h2o2.yaml";
+    string phase = "";
+    string fuel = "H2";
+    size_t nCases = 1000;
+    if (argc > 1) {
+        string arg = argv[1];
+        size_t colon = arg.rfind(':');
+        mech = arg.substr(0, colon);
+        if (colon != string::npos) {
+            phase = arg.substr(colon + 1);
+        }
+        fuel = (argc > 2) ? argv[2] : "CH4";
+    }
+    if (argc > 3) {
+        nCases = std::stoul(argv[3]);
+    }
+    try {
+        benchmark(mech, phase, fuel, nCases);
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Benchmark element potential equilibrium calculations
+ * ====================================================
+ *
+ * Compute equilibrium states with the ``ChemEquil`` solver on a grid of initial
+ * temperatures, pressures, and equivalence ratios, as is done when generating
+ * equilibrium lookup tables. The time per equilibrium calculation is reported for
+ * Jacobians computed by finite differences and analytically, and for starting each
+ * calculation from the solution at the previous grid point. The mechanism, fuel and
+ * number of grid points in each direction can be specified on the command line as
+ * ``equil_speed [mechanism.yaml[:phase] [fuel] [n_points]]``.
+ *
+ * .. tags:: C++, equilibrium, combustion, benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include "cantera/core.h"
+#include "cantera/equil/ChemEquil.h"
+
+using namespace Cantera;
+
+//! Equilibrate each point of the grid, returning the temperatures of the results
+vector<double> sweep(ThermoPhase& gas, const string& fuel, const string& XY,
+                     size_t n, bool analytic, bool warmStart, double& elapsed,
+                     size_t& failures)
+{
+    ChemEquil equil(gas);
+    equil.options.analyticJacobian = analytic;
+    equil.options.contin = warmStart;
+    vector<double> T;
+    failures = 0;
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        double P = OneAtm * (1.0 + 49.0 * i / (n - 1));
+        for (size_t j = 0; j < n; j++) {
+            double phi = 0.5 + 1.5 * j / (n - 1);
+            for (size_t k = 0; k < n; k++) {
+                double T0 = 300.0 + 900.0 * k / (n - 1);
+                gas.setState_TP(T0, P);
+                gas.setEquivalenceRatio(phi, fuel + ":1.0", "O2:1.0, N2:3.76");
+                try {
+                    equil.equilibrate(gas, XY.c_str());
+                    T.push_back(gas.temperature());
+                } catch (CanteraError&) {
+                    failures++;
+                    T.push_back(NAN);
+                }
+            }
+        }
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    elapsed = std::chrono::duration<double>(t2 - t1).count();
+    return T;
+}
+
+void benchmark(const string& mech, const string& phase, const string& fuel, size_t n)
+{
+    auto sol = newSolution(mech, phase, "none");
+    auto& gas = *sol->thermo();
+    size_t nPoints = n * n * n;
+    std::cout << mech << ": " << nPoints << " equilibrium states" << std::endl;
+    for (const string XY : {"TP", "HP"}) {
+        std::cout << "\n" << XY << "\n"
+            "Jacobian     start     time/state (ms)   speedup   failures   max |dT| (K)"
+            << std::endl;
+        double baseline = 0.0;
+        vector<double> Tref;
+        for (auto [analytic, warm] : {std::pair{false, false}, {true, false},
+                                      {true, true}}) {
+            double elapsed;
+            size_t failures;
+            auto T = sweep(gas, fuel, XY, n, analytic, warm, elapsed, failures);
+            double maxdT = 0.0;
+            if (Tref.empty()) {
+                Tref = T;
+                baseline = elapsed;
+            }
+            for (size_t i = 0; i < T.size(); i++) {
+                if (!std::isnan(T[i]) && !std::isnan(Tref[i])) {
+                    maxdT = std::max(maxdT, std::abs(T[i] - Tref[i]));
+                }
+            }
+            fmt::print("{:10s}   {:8s}  {:14.3f}   {:9.2f}   {:8d}   {:12.2e}\n",
+                       analytic ? "analytic" : "numerical", warm ? "warm" : "default",
+                       1e3 * elapsed / nPoints, baseline / elapsed, failures, maxdT);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    string mech = "gri30.yaml";
+    string phase = "";
+    string fuel = "CH4";
+    size_t n = 6;
+    if (argc > 1) {
+        mech = argv[1];
+        size_t colon = mech.find(':');
+        if (colon != string::npos) {
+            phase = mech.substr(colon + 1);
+            mech = mech.substr(0, colon);
+        }
+    }
+    if (argc > 2) {
+        fuel = argv[2];
+    }
+    if (argc > 3) {
+        n = std::max(std::stoul(argv[3]), 2ul);
+    }
+    try {
+        benchmark(mech, phase, fuel, n);
+    } catch (std::exception& err) {
+        std::cout << err.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * Benchmark approximate mixture rules
+ * ===================================
+ *
+ * Compare the cost of evaluating the mixture viscosity with the Wilke mixture rule
+ * used by the ``mixture-averaged`` transport model and the truncated mixture rule
+ * used by the ``mixture-averaged-approximate`` transport model, for an increasing
+ * number of species. Larger mechanisms are emulated by adding copies of all species
+ * in GRI 3.0 that are present only in trace amounts, which is representative of
+ * the minor species in detailed mechanisms. Each evaluation is done at a new
+ * temperature, so all temperature-dependent terms are recomputed.
+ *
+ * .. tags:: C++, transport, benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include "cantera/core.h"
+#include "cantera/thermo.h"
+#include "cantera/transport.h"
+
+using namespace Cantera;
+
+//! Average time [μs] required to evaluate the viscosity at a new temperature
+double timeViscosity(ThermoPhase& gas, Transport& tran, size_t loops)
+{
+    double T = 1500.;
+    double P = gas.pressure();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < loops; ++i) {
+        gas.setState_TP(T + i * 1e-3, P);
+        tran.viscosity();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count()
+        / 1000. / loops;
+}
+
+void benchmark(size_t nCopies)
+{
+    auto gas = newThermo("gri30.yaml", "gri30");
+    size_t nBase = gas->nSpecies();
+
+    // equilibrium composition of a stoichiometric methane/air flame
+    gas->setEquivalenceRatio(1.0, "CH4", "O2:0.21, N2:0.79");
+    gas->setState_TP(300.0, OneAtm);
+    gas->equilibrate("HP");
+    vector<double> X(nBase);
+    gas->getMoleFractions(X.data());
+
+    AnyMap input = AnyMap::fromYamlFile("gri30.yaml");
+    for (size_t n = 0; n < nCopies; n++) {
+        for (auto& spec : input["species"].asVector<AnyMap>()) {
+            AnyMap copy = spec;
+            copy["name"] = fmt::format("{}-{}", spec["name"].asString(), n);
+            gas->addSpecies(newSpecies(copy));
+        }
+    }
+    X.resize(gas->nSpecies(), 0.0);
+    gas->setState_TPX(1500.0, OneAtm, X.data());
+
+    auto mix = newTransport(gas, "mixture-averaged");
+    auto approx = newTransport(gas, "mixture-averaged-approximate");
+    double rel = approx->viscosity() / mix->viscosity() - 1.0;
+
+    size_t nsp = gas->nSpecies();
+    size_t loops = std::max<size_t>(20, 100000000 / (nsp * nsp));
+    double tMix = timeViscosity(*gas, *mix, loops);
+    double tApprox = timeViscosity(*gas, *approx, loops);
+    std::cout << std::setw(8) << nsp
+        << std::setw(14) << std::setprecision(4) << tMix
+        << std::setw(14) << std::setprecision(4) << tApprox
+        << std::setw(10) << std::setprecision(3) << tMix / tApprox
+        << std::setw(14) << std::setprecision(2) << rel << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "Benchmark tests for approximate mixture rules." << std::endl;
+    std::cout << std::endl;
+    std::cout << std::setw(8) << "species" << std::setw(14) << "Wilke [μs]"
+        << std::setw(14) << "approx [μs]" << std::setw(10) << "speedup"
+        << std::setw(14) << "rel. diff." << std::endl;
+    for (size_t nCopies : {0, 1, 3, 7, 15, 31}) {
+        benchmark(nCopies);
+    }
+    return 0;
+}
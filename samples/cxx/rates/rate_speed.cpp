@@ -0,0 +1,145 @@
+/*
+ * Benchmark packed rate evaluations
+ * =================================
+ *
+ * Compare the evaluation of rate constants from packed parameter arrays
+ * (structure-of-arrays layout, as used by ``MultiRate``) with a loop over individual
+ * rate objects (array-of-structures layout). Evaluation is timed for reactions using
+ * Arrhenius, Chebyshev, and PLOG rate expressions in different chemical mechanisms;
+ * additional mechanisms, for example ones with many pressure-dependent reactions, can
+ * be specified as ``mechanism.yaml:phase`` on the command line.
+ *
+ * .. tags:: C++, kinetics, benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <numeric>
+#include "cantera/core.h"
+#include "cantera/kinetics.h"
+#include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/ChebyshevRate.h"
+#include "cantera/kinetics/PlogRate.h"
+
+using namespace Cantera;
+
+void statistics(vector<double> times, size_t loops, size_t runs)
+{
+    double average = accumulate(times.begin(), times.end(), 0.0) / times.size();
+    for (auto& v : times) {
+        v = (v - average) * (v - average);
+    }
+    double std = accumulate(times.begin(), times.end(), 0.0) / times.size();
+    std = pow(std, 0.5);
+
+    // output statistics
+    std::cout << std::setprecision(5) << average / 1000. << " μs ± "
+        << std::setprecision(3) << std / 1000. << " μs "
+        << "per loop (" << runs << " runs, " << loops << " loops each)\n";
+}
+
+//! timer for a rate evaluation function taking temperature as argument
+template <class Function>
+void timeit(Function eval, size_t loops=10000, size_t runs=7)
+{
+    double T = 1500.;
+    double deltaT = 1e-3;
+
+    vector<double> times;
+    for (size_t run = 0; run < runs; ++run) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < loops; ++i) {
+            eval(T + i * deltaT);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        times.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count() /
+            loops);
+    }
+    statistics(times, loops, runs);
+}
+
+//! time evaluation of all reactions using the rate type `RateType`
+template <class RateType, class DataType>
+void benchmarkRates(Kinetics& kin, double P)
+{
+    constexpr bool pdep = !std::is_same_v<RateType, ArrheniusRate>;
+    vector<pair<size_t, RateType>> rates;
+    auto packed = RateType().newMultiRate();
+    for (size_t i = 0; i < kin.nReactions(); i++) {
+        auto rate = std::dynamic_pointer_cast<RateType>(kin.reaction(i)->rate());
+        if (rate) {
+            rates.emplace_back(i, *rate);
+            packed->add(i, *rate);
+        }
+    }
+    if (rates.empty()) {
+        return;
+    }
+    std::cout << rates.size() << " reactions with " << rates[0].second.type()
+        << " rates" << std::endl;
+
+    vector<double> kf(kin.nReactions());
+    DataType data;
+
+    std::cout << "  array of structures:  ";
+    timeit([&](double T) {
+        if constexpr (pdep) {
+            data.update(T, P);
+        } else {
+            data.update(T);
+        }
+        for (auto& [iRxn, rate] : rates) {
+            if constexpr (pdep) {
+                rate.updateFromStruct(data);
+            }
+            kf[iRxn] = rate.evalFromStruct(data);
+        }
+    });
+
+    std::cout << "  structure of arrays:  ";
+    timeit([&](double T) {
+        if constexpr (pdep) {
+            packed->update(T, P);
+        } else {
+            packed->update(T);
+        }
+        packed->getRateConstants(kf.data());
+    });
+}
+
+void benchmark(const string& mech, const string& phase)
+{
+    auto sol = newSolution(mech, phase, "none");
+    auto& kin = *(sol->kinetics());
+    std::cout << mech << ": " << kin.nReactions() << " reactions" << std::endl;
+
+    double P = OneAtm;
+    benchmarkRates<ArrheniusRate, ArrheniusData>(kin, P);
+    benchmarkRates<ChebyshevRate, ChebyshevData>(kin, P);
+    benchmarkRates<PlogRate, PlogData>(kin, P);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << "Benchmark tests for packed rate evaluations." << std::endl;
+    std::cout << std::endl;
+    benchmark("gri30.yaml", "gri30");
+    std::cout << std::endl;
+    benchmark("nDodecane_Reitz.yaml", "nDodecane_IG");
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        size_t colon = arg.rfind(':');
+        std::cout << std::endl;
+        if (colon == string::npos) {
+            benchmark(arg, "");
+        } else {
+            benchmark(arg.substr(0, colon), arg.substr(colon + 1));
+        }
+    }
+    return 0;
+}
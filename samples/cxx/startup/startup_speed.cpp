@@ -0,0 +1,98 @@
+/*
+ * Benchmark mechanism loading
+ * ===========================
+ *
+ * Measure the time needed to create a ``Solution`` object from a YAML input file,
+ * which is repeated by every process that loads a mechanism. The time is reported
+ * when the YAML file is parsed, when the parsed input is read from the binary input
+ * cache set up using ``AnyMap::setInputCacheDir``, and when the parsed input is
+ * already held in memory by the current process. For comparison, the time needed to
+ * create a copy of an existing ``Solution`` object using ``Solution::clone``, for
+ * example to provide independent objects to each thread of a parallel calculation,
+ * is also reported. Mechanisms can be specified on the command line as
+ * ``startup_speed [mechanism.yaml[:phase] ...]``.
+ *
+ * .. tags:: C++, input files, benchmarking
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include "cantera/core.h"
+
+using namespace Cantera;
+
+//! Average time (in ms) required to create a Solution object
+double loadTime(const string& mech, const string& phase, bool clearMemory, int nRuns)
+{
+    double elapsed = 0.0;
+    for (int i = 0; i < nRuns; i++) {
+        if (clearMemory) {
+            AnyMap::clearCachedFile(mech);
+        }
+        auto t1 = std::chrono::high_resolution_clock::now();
+        auto sol = newSolution(mech, phase);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        elapsed += std::chrono::duration<double, std::milli>(t2 - t1).count();
+    }
+    return elapsed / nRuns;
+}
+
+void benchmark(const string& mech, const string& phase, const string& cacheDir)
+{
+    int nRuns = 10;
+    auto sol = newSolution(mech, phase);
+    std::cout << mech << ": " << sol->thermo()->nSpecies() << " species, "
+        << sol->kinetics()->nReactions() << " reactions" << std::endl;
+
+    AnyMap::setInputCacheDir("");
+    double parsed = loadTime(mech, phase, true, nRuns);
+
+    AnyMap::setInputCacheDir(cacheDir);
+    loadTime(mech, phase, true, 1); // write the cache file
+    double cached = loadTime(mech, phase, true, nRuns);
+    double memory = loadTime(mech, phase, false, nRuns);
+    AnyMap::setInputCacheDir("");
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < nRuns; i++) {
+        auto copy = sol->clone();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    double cloned = std::chrono::duration<double, std::milli>(t2 - t1).count() / nRuns;
+
+    std::cout << "    parse YAML file:    " << parsed << " ms\n"
+        << "    binary input cache: " << cached << " ms (speedup "
+        << parsed / cached << ")\n"
+        << "    in-memory input:    " << memory << " ms\n"
+        << "    Solution::clone:    " << cloned << " ms\n" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    vector<string> mechanisms;
+    for (int i = 1; i < argc; i++) {
+        mechanisms.push_back(argv[i]);
+    }
+    if (mechanisms.empty()) {
+        mechanisms = {"gri30.yaml", "nDodecane_Reitz.yaml"};
+    }
+    auto cacheDir = std::filesystem::temp_directory_path() / "cantera-startup-speed";
+    try {
+        for (const auto& spec : mechanisms) {
+            size_t colon = spec.find(':');
+            string mech = spec.substr(0, colon);
+            string phase = (colon == npos) ? "" : spec.substr(colon + 1);
+            benchmark(mech, phase, cacheDir.string());
+        }
+    } catch (CanteraError& err) {
+        std::cerr << err.what() << std::endl;
+        std::filesystem::remove_all(cacheDir);
+        return 1;
+    }
+    std::filesystem::remove_all(cacheDir);
+    return 0;
+}
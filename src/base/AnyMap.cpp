@@ -12,6 +12,9 @@
 #include <boost/algorithm/string.hpp>
 #include <fstream>
 #include <mutex>
+#include <shared_mutex>
+#include <random>
+#include <sstream>
 #include <unordered_set>
 
 namespace ba = boost::algorithm;
@@ -19,7 +22,7 @@ namespace ba = boost::algorithm;
 namespace { // helper functions
 
 std::mutex yaml_cache_mutex;
-std::mutex yaml_field_order_mutex;
+std::shared_mutex yaml_field_order_mutex;
 using namespace Cantera;
 
 bool isFloat(const string& val)
@@ -244,6 +247,106 @@ struct Quantity
 
 Cantera::AnyValue Empty;
 
+// Helper functions for binary input cache files
+
+//! Version of the binary input cache format. Increment when the layout changes.
+const uint32_t inputCacheVersion = 1;
+
+//! Identifier at the start of each binary input cache file
+const char inputCacheMagic[8] = {'C', 'T', 'I', 'N', 'P', 'U', 'T', '\0'};
+
+//! Types of values stored in binary input cache files
+enum class CacheType : uint8_t {
+    Empty, Double, Integer, Bool, String, Map, DoubleVector, IntegerVector,
+    BoolVector, StringVector, MapVector, ValueVector, DoubleMatrix, IntegerMatrix,
+    BoolMatrix, StringMatrix
+};
+
+//! 64-bit FNV-1a hash, used to identify the input file contents
+uint64_t fnv1aHash(const string& data)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : data) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+template <class T>
+void writeRaw(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+T readRaw(std::istream& in)
+{
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!in) {
+        throw CanteraError("readRaw", "Unexpected end of input cache file");
+    }
+    return value;
+}
+
+void writeRaw(std::ostream& out, const string& value)
+{
+    writeRaw(out, static_cast<uint64_t>(value.size()));
+    out.write(value.data(), value.size());
+}
+
+template <>
+string readRaw<string>(std::istream& in)
+{
+    string value(readRaw<uint64_t>(in), '\0');
+    in.read(value.data(), value.size());
+    if (!in) {
+        throw CanteraError("readRaw", "Unexpected end of input cache file");
+    }
+    return value;
+}
+
+template <>
+bool readRaw<bool>(std::istream& in)
+{
+    return readRaw<uint8_t>(in) != 0;
+}
+
+void writeRaw(std::ostream& out, bool value)
+{
+    writeRaw(out, static_cast<uint8_t>(value));
+}
+
+template <class T>
+void writeRaw(std::ostream& out, const vector<T>& values)
+{
+    writeRaw(out, static_cast<uint64_t>(values.size()));
+    for (const auto& value : values) {
+        writeRaw(out, static_cast<const T&>(value));
+    }
+}
+
+template <class T>
+vector<T> readVector(std::istream& in)
+{
+    vector<T> values(readRaw<uint64_t>(in));
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = readRaw<T>(in);
+    }
+    return values;
+}
+
+template <class T>
+vector<vector<T>> readMatrix(std::istream& in)
+{
+    vector<vector<T>> values(readRaw<uint64_t>(in));
+    for (auto& row : values) {
+        row = readVector<T>(in);
+    }
+    return values;
+}
+
 } // end anonymous namespace
 
 namespace YAML { // YAML converters
@@ -594,8 +697,13 @@ struct convert<Cantera::AnyValue> {
 
 namespace Cantera {
 
-std::unordered_map<string,
-                   pair<AnyMap, std::filesystem::file_time_type>> AnyMap::s_cache;
+std::unordered_map<string, pair<shared_ptr<const AnyMap>,
+                                std::filesystem::file_time_type>> AnyMap::s_cache;
+
+string AnyMap::s_inputCacheDir = []() {
+    const char* dir = getenv("CANTERA_CACHE_DIR");
+    return dir ? string(dir) : string();
+}();
 
 std::unordered_map<string, vector<string>> AnyMap::s_headFields;
 std::unordered_map<string, vector<string>> AnyMap::s_tailFields;
@@ -1669,9 +1777,10 @@ AnyMap::OrderedProxy::OrderedProxy(const AnyMap& data, bool withUnits)
     if (m_data->hasKey("__type__")) {
         bool order_changed = false;
         const auto& itemType = m_data->at("__type__").asString();
-        std::unique_lock<std::mutex> lock(yaml_field_order_mutex);
-        if (AnyMap::s_headFields.count(itemType)) {
-            for (const auto& key : AnyMap::s_headFields[itemType]) {
+        std::shared_lock<std::shared_mutex> lock(yaml_field_order_mutex);
+        auto headFields = AnyMap::s_headFields.find(itemType);
+        if (headFields != AnyMap::s_headFields.end()) {
+            for (const auto& key : headFields->second) {
                 for (auto& [order, item] : m_ordered) {
                     if (order.first >= 0) {
                         // This and following items come from an input file and
@@ -1685,8 +1794,9 @@ AnyMap::OrderedProxy::OrderedProxy(const AnyMap& data, bool withUnits)
                 }
             }
         }
-        if (AnyMap::s_tailFields.count(itemType)) {
-            for (const auto& key : AnyMap::s_tailFields[itemType]) {
+        auto tailFields = AnyMap::s_tailFields.find(itemType);
+        if (tailFields != AnyMap::s_tailFields.end()) {
+            for (const auto& key : tailFields->second) {
                 for (auto& [order, item] : m_ordered) {
                     if (order.first >= 0) {
                         // This and following items come from an input file and
@@ -1798,7 +1908,7 @@ void AnyMap::setFlowStyle(bool flow) {
 bool AnyMap::addOrderingRules(const string& objectType,
                              const vector<vector<string>>& specs)
 {
-    std::unique_lock<std::mutex> lock(yaml_field_order_mutex);
+    std::unique_lock<std::shared_mutex> lock(yaml_field_order_mutex);
     for (const auto& spec : specs) {
         if (spec.at(0) == "head") {
             s_headFields[objectType].insert(s_headFields[objectType].begin(),
@@ -1816,9 +1926,8 @@ bool AnyMap::addOrderingRules(const string& objectType,
 void AnyMap::clearCachedFile(const string& filename)
 {
     string fullName = findInputFile(filename);
-    if (s_cache.count(fullName)) {
-        s_cache.erase(fullName);
-    }
+    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+    s_cache.erase(fullName);
 }
 
 AnyMap AnyMap::fromYamlString(const string& yaml) {
@@ -1855,12 +1964,20 @@ AnyMap AnyMap::fromYamlFile(const string& name, const string& parent_name)
     }
 
     // Check for an already-parsed YAML file with the same last-modified time,
-    // and return that if possible
+    // and return that if possible. The lock is only held for the lookup, so
+    // different files can be parsed concurrently and the copy returned to the
+    // caller is made from the immutable cache entry without blocking other threads.
     auto mtime = std::filesystem::last_write_time(fullName);
-    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
-    auto iter = s_cache.find(fullName);
-    if (iter != s_cache.end() && iter->second.second == mtime) {
-        return iter->second.first;
+    string cacheDir;
+    {
+        std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+        auto iter = s_cache.find(fullName);
+        if (iter != s_cache.end() && iter->second.second == mtime) {
+            auto cached = iter->second.first;
+            lock.unlock();
+            return *cached;
+        }
+        cacheDir = s_inputCacheDir;
     }
 
     if (!std::ifstream(fullName).good()) {
@@ -1869,32 +1986,274 @@ AnyMap AnyMap::fromYamlFile(const string& name, const string& parent_name)
     }
 
     // Generate an AnyMap from the YAML file and store it in the cache
-    auto& [cache_item, cache_time] = s_cache[fullName];
-    cache_time = mtime;
+    auto item = make_shared<AnyMap>();
     try {
-        YAML::Node node = YAML::LoadFile(fullName);
-        cache_item = node.as<AnyMap>();
-        cache_item.setMetadata("filename", AnyValue(fullName));
-        cache_item.applyUnits();
+        if (cacheDir.empty()) {
+            YAML::Node node = YAML::LoadFile(fullName);
+            *item = node.as<AnyMap>();
+        } else {
+            *item = fromInputCache(fullName, cacheDir);
+        }
+        item->setMetadata("filename", AnyValue(fullName));
+        item->applyUnits();
     } catch (YAML::Exception& err) {
-        s_cache.erase(fullName);
         AnyMap fake;
         fake.setLoc(err.mark.line, err.mark.column);
         fake.setMetadata("filename", AnyValue(fullName));
         throw InputFileError("AnyMap::fromYamlFile", fake, err.msg);
-    } catch (CanteraError&) {
-        s_cache.erase(fullName);
-        throw;
     }
-    cache_item["__file__"] = fullName;
-    cache_item.setLoc(0, 0);
+    (*item)["__file__"] = fullName;
+    item->setLoc(0, 0);
 
-    if (cache_item.hasKey("deprecated")) {
-        warn_deprecated(fullName, cache_item["deprecated"].asString());
+    {
+        std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+        s_cache[fullName] = {item, mtime};
+    }
+
+    if (item->hasKey("deprecated")) {
+        warn_deprecated(fullName, item->at("deprecated").asString());
     }
 
     // Return a copy of the AnyMap
-    return cache_item;
+    return *item;
+}
+
+void AnyMap::setInputCacheDir(const string& dir)
+{
+    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+    s_inputCacheDir = dir;
+}
+
+string AnyMap::inputCacheDir()
+{
+    std::unique_lock<std::mutex> lock(yaml_cache_mutex);
+    return s_inputCacheDir;
+}
+
+AnyMap AnyMap::fromInputCache(const string& fullName, const string& cacheDir)
+{
+    std::ifstream infile(fullName, std::ios::binary);
+    std::stringstream buffer;
+    buffer << infile.rdbuf();
+    string contents = buffer.str();
+    uint64_t hash = fnv1aHash(contents);
+    auto path = std::filesystem::path(cacheDir) / fmt::format("{}-{:016x}.bin",
+        std::filesystem::path(fullName).stem().string(), hash);
+
+    AnyMap out;
+    std::ifstream cached(path, std::ios::binary);
+    if (cached) {
+        try {
+            char magic[sizeof(inputCacheMagic)];
+            cached.read(magic, sizeof(magic));
+            // Cache files written by other Cantera versions, other versions of the
+            // cache format, or on machines with a different byte order are ignored
+            if (cached && std::equal(magic, magic + sizeof(magic), inputCacheMagic)
+                && readRaw<uint32_t>(cached) == inputCacheVersion
+                && readRaw<string>(cached) == CANTERA_VERSION
+                && readRaw<uint64_t>(cached) == hash
+                && readRaw<uint64_t>(cached) == contents.size())
+            {
+                out.readBinary(cached);
+                return out;
+            }
+        } catch (std::exception&) {
+            // Ignore unreadable cache files, which are replaced below
+        }
+        out = AnyMap();
+    }
+
+    YAML::Node node = YAML::Load(contents);
+    out = node.as<AnyMap>();
+
+    // Write to a temporary file first so other processes never see a partially
+    // written cache file
+    auto tmpPath = path;
+    tmpPath += fmt::format(".{:x}.tmp", std::random_device()());
+    try {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream cacheOut(tmpPath, std::ios::binary);
+        cacheOut.write(inputCacheMagic, sizeof(inputCacheMagic));
+        writeRaw(cacheOut, inputCacheVersion);
+        writeRaw(cacheOut, string(CANTERA_VERSION));
+        writeRaw(cacheOut, hash);
+        writeRaw(cacheOut, static_cast<uint64_t>(contents.size()));
+        out.writeBinary(cacheOut);
+        cacheOut.close();
+        if (!cacheOut) {
+            throw CanteraError("AnyMap::fromInputCache",
+                "Error writing file '{}'", tmpPath.string());
+        }
+        std::filesystem::rename(tmpPath, path);
+    } catch (std::exception& err) {
+        std::error_code ec;
+        std::filesystem::remove(tmpPath, ec);
+        warn_user("AnyMap::fromInputCache",
+            "Unable to write input cache file for '{}':\n{}", fullName, err.what());
+    }
+    return out;
+}
+
+void AnyMap::writeBinary(std::ostream& out) const
+{
+    writeRaw(out, m_line);
+    writeRaw(out, m_column);
+    writeRaw(out, static_cast<uint64_t>(m_data.size()));
+    for (const auto& [key, value] : m_data) {
+        writeRaw(out, key);
+        value.writeBinary(out);
+    }
+}
+
+void AnyMap::readBinary(std::istream& in)
+{
+    m_line = readRaw<int>(in);
+    m_column = readRaw<int>(in);
+    size_t n = readRaw<uint64_t>(in);
+    for (size_t i = 0; i < n; i++) {
+        string key = readRaw<string>(in);
+        createForYaml(key, -1, 0).readBinary(in);
+    }
+}
+
+void AnyValue::writeBinary(std::ostream& out) const
+{
+    writeRaw(out, m_line);
+    writeRaw(out, m_column);
+    const auto& type = m_value.type();
+    if (!m_value.has_value()) {
+        writeRaw(out, CacheType::Empty);
+    } else if (type == typeid(double)) {
+        writeRaw(out, CacheType::Double);
+        writeRaw(out, as<double>());
+    } else if (type == typeid(long int)) {
+        writeRaw(out, CacheType::Integer);
+        writeRaw(out, as<long int>());
+    } else if (type == typeid(bool)) {
+        writeRaw(out, CacheType::Bool);
+        writeRaw(out, as<bool>());
+    } else if (type == typeid(string)) {
+        writeRaw(out, CacheType::String);
+        writeRaw(out, as<string>());
+    } else if (type == typeid(AnyMap)) {
+        writeRaw(out, CacheType::Map);
+        as<AnyMap>().writeBinary(out);
+    } else if (type == typeid(vector<double>)) {
+        writeRaw(out, CacheType::DoubleVector);
+        writeRaw(out, as<vector<double>>());
+    } else if (type == typeid(vector<long int>)) {
+        writeRaw(out, CacheType::IntegerVector);
+        writeRaw(out, as<vector<long int>>());
+    } else if (type == typeid(vector<bool>)) {
+        writeRaw(out, CacheType::BoolVector);
+        writeRaw(out, as<vector<bool>>());
+    } else if (type == typeid(vector<string>)) {
+        writeRaw(out, CacheType::StringVector);
+        writeRaw(out, as<vector<string>>());
+    } else if (type == typeid(vector<AnyMap>)) {
+        writeRaw(out, CacheType::MapVector);
+        const auto& items = as<vector<AnyMap>>();
+        writeRaw(out, static_cast<uint64_t>(items.size()));
+        for (const auto& item : items) {
+            item.writeBinary(out);
+        }
+    } else if (type == typeid(vector<AnyValue>)) {
+        writeRaw(out, CacheType::ValueVector);
+        const auto& items = as<vector<AnyValue>>();
+        writeRaw(out, static_cast<uint64_t>(items.size()));
+        for (const auto& item : items) {
+            item.writeBinary(out);
+        }
+    } else if (type == typeid(vector<vector<double>>)) {
+        writeRaw(out, CacheType::DoubleMatrix);
+        writeRaw(out, as<vector<vector<double>>>());
+    } else if (type == typeid(vector<vector<long int>>)) {
+        writeRaw(out, CacheType::IntegerMatrix);
+        writeRaw(out, as<vector<vector<long int>>>());
+    } else if (type == typeid(vector<vector<bool>>)) {
+        writeRaw(out, CacheType::BoolMatrix);
+        writeRaw(out, as<vector<vector<bool>>>());
+    } else if (type == typeid(vector<vector<string>>)) {
+        writeRaw(out, CacheType::StringMatrix);
+        writeRaw(out, as<vector<vector<string>>>());
+    } else {
+        throw CanteraError("AnyValue::writeBinary",
+            "Don't know how to store value of type '{}' with key '{}'",
+            type_str(), m_key);
+    }
+}
+
+void AnyValue::readBinary(std::istream& in)
+{
+    int line = readRaw<int>(in);
+    int column = readRaw<int>(in);
+    auto type = readRaw<CacheType>(in);
+    switch (type) {
+    case CacheType::Empty:
+        break;
+    case CacheType::Double:
+        *this = readRaw<double>(in);
+        break;
+    case CacheType::Integer:
+        *this = readRaw<long int>(in);
+        break;
+    case CacheType::Bool:
+        *this = readRaw<bool>(in);
+        break;
+    case CacheType::String:
+        *this = readRaw<string>(in);
+        break;
+    case CacheType::Map: {
+        AnyMap item;
+        item.readBinary(in);
+        *this = std::move(item);
+        break;
+    }
+    case CacheType::DoubleVector:
+        *this = readVector<double>(in);
+        break;
+    case CacheType::IntegerVector:
+        *this = readVector<long int>(in);
+        break;
+    case CacheType::BoolVector:
+        *this = readVector<bool>(in);
+        break;
+    case CacheType::StringVector:
+        *this = readVector<string>(in);
+        break;
+    case CacheType::MapVector: {
+        vector<AnyMap> items(readRaw<uint64_t>(in));
+        for (auto& item : items) {
+            item.readBinary(in);
+        }
+        *this = std::move(items);
+        break;
+    }
+    case CacheType::ValueVector: {
+        vector<AnyValue> items(readRaw<uint64_t>(in));
+        for (auto& item : items) {
+            item.readBinary(in);
+        }
+        *this = std::move(items);
+        break;
+    }
+    case CacheType::DoubleMatrix:
+        *this = readMatrix<double>(in);
+        break;
+    case CacheType::IntegerMatrix:
+        *this = readMatrix<long int>(in);
+        break;
+    case CacheType::BoolMatrix:
+        *this = readMatrix<bool>(in);
+        break;
+    case CacheType::StringMatrix:
+        *this = readMatrix<string>(in);
+        break;
+    default:
+        throw CanteraError("AnyValue::readBinary",
+            "Invalid value type in input cache file");
+    }
+    setLoc(line, column);
 }
 
 string AnyMap::toYamlString() const
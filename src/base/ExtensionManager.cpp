@@ -5,6 +5,8 @@
 
 #include "cantera/base/ExtensionManager.h"
 #include "cantera/base/global.h"
+#include <mutex>
+#include <shared_mutex>
 
 namespace Cantera
 {
@@ -13,21 +15,31 @@ map<string, function<void(ReactionDataDelegator&)>> ExtensionManager::s_Reaction
 map<string, function<shared_ptr<ExternalHandle>(shared_ptr<Solution>)>> ExtensionManager::s_Solution_linkers = {};
 map<string, string> ExtensionManager::s_userTypeToWrapperType = {};
 
+//! Mutex guarding the static maps of ExtensionManager. Lookups, which happen
+//! whenever objects of user-defined types are constructed, only need shared access.
+static std::shared_mutex linker_mutex;
+
 void ExtensionManager::wrapReactionData(const string& rateName,
                                         ReactionDataDelegator& data)
 {
-    if (s_ReactionData_linkers.count(rateName) != 0) {
-        s_ReactionData_linkers.at(rateName)(data);
-    } else {
-        throw CanteraError("ExtensionManager::wrapReactionData",
-                           "No ReactionData delegator for type {} registered",
-                           rateName);
+    function<void(ReactionDataDelegator&)> link;
+    {
+        std::shared_lock<std::shared_mutex> lock(linker_mutex);
+        auto iter = s_ReactionData_linkers.find(rateName);
+        if (iter == s_ReactionData_linkers.end()) {
+            throw CanteraError("ExtensionManager::wrapReactionData",
+                               "No ReactionData delegator for type {} registered",
+                               rateName);
+        }
+        link = iter->second;
     }
+    link(data);
 }
 
 void ExtensionManager::registerReactionDataLinker(const string& rateName,
     const string& wrapperName, function<void(ReactionDataDelegator& delegator)> link)
 {
+    std::unique_lock<std::shared_mutex> lock(linker_mutex);
     s_ReactionData_linkers[rateName] = link;
     s_userTypeToWrapperType[rateName] = wrapperName;
 }
@@ -35,25 +47,33 @@ void ExtensionManager::registerReactionDataLinker(const string& rateName,
 shared_ptr<ExternalHandle> ExtensionManager::wrapSolution(
     const string& rateName, shared_ptr<Solution> soln)
 {
-    if (s_Solution_linkers.count(rateName) != 0) {
-        return s_Solution_linkers.at(rateName)(soln);
-    } else {
-        throw CanteraError("ExtensionManager::wrapSolution",
-                           "No Solution linker for type {} registered",
-                           rateName);
+    function<shared_ptr<ExternalHandle>(shared_ptr<Solution>)> link;
+    {
+        std::shared_lock<std::shared_mutex> lock(linker_mutex);
+        auto iter = s_Solution_linkers.find(rateName);
+        if (iter == s_Solution_linkers.end()) {
+            throw CanteraError("ExtensionManager::wrapSolution",
+                               "No Solution linker for type {} registered",
+                               rateName);
+        }
+        link = iter->second;
     }
+    return link(soln);
 }
 
 void ExtensionManager::registerSolutionLinker(const string& rateName,
     function<shared_ptr<ExternalHandle>(shared_ptr<Solution>)> link)
 {
+    std::unique_lock<std::shared_mutex> lock(linker_mutex);
     s_Solution_linkers[rateName] = link;
 }
 
 string ExtensionManager::getSolutionWrapperType(const string& userType)
 {
-    if (s_userTypeToWrapperType.count(userType)) {
-        return s_userTypeToWrapperType[userType];
+    std::shared_lock<std::shared_mutex> lock(linker_mutex);
+    auto iter = s_userTypeToWrapperType.find(userType);
+    if (iter != s_userTypeToWrapperType.end()) {
+        return iter->second;
     } else {
         throw CanteraError("ExtensionManager::getSolutionWrapperType",
                            "No Solution linker for type {} registered", userType);
@@ -22,6 +22,67 @@
 namespace Cantera
 {
 
+shared_ptr<Solution> Solution::clone()
+{
+    map<Solution*, shared_ptr<Solution>> related;
+    return clone(related);
+}
+
+shared_ptr<Solution> Solution::clone(map<Solution*, shared_ptr<Solution>>& related)
+{
+    if (!m_thermo) {
+        throw CanteraError("Solution::clone", "Requires associated 'ThermoPhase'");
+    }
+    auto thermo = newThermoModel(m_thermo->type());
+    setupPhase(*thermo, *m_thermo);
+
+    // instantiate Solution object of the correct derived type
+    shared_ptr<Solution> sol;
+    switch (thermo->nDim()) {
+    case 2:
+        sol = Interface::create();
+        break;
+    default:
+        sol = Solution::create();
+    }
+    related[this] = sol;
+    sol->setSource(source());
+    sol->setThermo(thermo);
+    sol->m_header = m_header;
+
+    // Copy adjacent phases, unless they have already been copied as part of a more
+    // complex interface
+    for (auto& adj : m_adjacent) {
+        auto iter = related.find(adj.get());
+        sol->addAdjacent(iter != related.end() ? iter->second : adj->clone(related));
+    }
+
+    if (m_kinetics) {
+        map<ThermoPhase*, shared_ptr<ThermoPhase>> copies;
+        for (auto& [original, copy] : related) {
+            copies[original->thermo().get()] = copy->thermo();
+        }
+        auto kin = newKinetics(m_kinetics->kineticsType());
+        sol->setKinetics(kin);
+        for (size_t i = 0; i < m_kinetics->nPhases(); i++) {
+            auto phase = copies.find(m_kinetics->phase(i).get());
+            if (phase == copies.end()) {
+                throw CanteraError("Solution::clone", "Phase '{}' used by the kinetics "
+                    "of phase '{}' is not an adjacent phase.",
+                    m_kinetics->phase(i)->name(), name());
+            }
+            kin->addThermo(phase->second);
+        }
+        kin->init();
+        addReactions(*kin, *m_kinetics);
+    }
+
+    if (m_transport) {
+        sol->setTransport(m_transport->clone(thermo));
+    }
+    return sol;
+}
+
 string Solution::name() const {
     if (m_thermo) {
         return m_thermo->name();
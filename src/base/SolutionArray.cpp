@@ -10,12 +10,17 @@
 #include "cantera/base/Solution.h"
 #include "cantera/base/Storage.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/ThreadPool.h"
+#include "cantera/equil/ChemEquil.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/base/utilities.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/reversed.hpp>
+#include <charconv>
+#include <cstring>
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
 
@@ -849,6 +854,162 @@ void SolutionArray::normalize() {
     }
 }
 
+namespace { // restrict scope of helper functions to local translation unit
+
+//! Order points so that consecutive points are close to each other, by sorting them
+//! along the Z-order (Morton) curve. Each feature is scaled by its range.
+vector<size_t> zOrder(const vector<vector<double>>& features)
+{
+    size_t nPoints = features.size();
+    vector<size_t> order(nPoints);
+    std::iota(order.begin(), order.end(), 0);
+    if (nPoints < 3) {
+        return order;
+    }
+
+    // Only features that vary contribute to the ordering
+    size_t nFeatures = features[0].size();
+    vector<double> fmin(nFeatures, BigNumber), fmax(nFeatures, -BigNumber);
+    for (const auto& f : features) {
+        for (size_t j = 0; j < nFeatures; j++) {
+            fmin[j] = std::min(fmin[j], f[j]);
+            fmax[j] = std::max(fmax[j], f[j]);
+        }
+    }
+    vector<size_t> varying;
+    for (size_t j = 0; j < nFeatures && varying.size() < 63; j++) {
+        if (fmax[j] - fmin[j] > 1e-12 * std::max(std::abs(fmax[j]), 1.0)) {
+            varying.push_back(j);
+        }
+    }
+    if (varying.empty()) {
+        return order;
+    }
+
+    // Interleave the bits of the quantized features
+    size_t nBits = std::min<size_t>(63 / varying.size(), 20);
+    double nLevels = static_cast<double>((uint64_t(1) << nBits) - 1);
+    vector<uint64_t> keys(nPoints, 0);
+    for (size_t i = 0; i < nPoints; i++) {
+        for (size_t n = 0; n < varying.size(); n++) {
+            size_t j = varying[n];
+            auto q = static_cast<uint64_t>(
+                std::round((features[i][j] - fmin[j]) / (fmax[j] - fmin[j]) * nLevels));
+            for (size_t b = 0; b < nBits; b++) {
+                keys[i] |= ((q >> b) & 1) << (b * varying.size() + n);
+            }
+        }
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+    return order;
+}
+
+} // end unnamed namespace
+
+void SolutionArray::equilibrate(const string& XY, const string& solver,
+                                size_t nThreads)
+{
+    if (solver != "auto" && solver != "element_potential" && solver != "vcs"
+        && solver != "gibbs")
+    {
+        throw CanteraError("SolutionArray::equilibrate",
+                           "Invalid solver specified: '{}'", solver);
+    }
+    _equilflag(XY.c_str()); // check for a valid property pair before starting
+
+    // Extract the states serially, since accessing the SolutionArray modifies the
+    // state of its Solution
+    auto phase = m_sol->thermo();
+    size_t nStates = m_size;
+    vector<vector<double>> states(nStates);
+    vector<vector<double>> features(nStates);
+    for (size_t i = 0; i < nStates; i++) {
+        states[i] = getState(static_cast<int>(i));
+        auto& f = features[i];
+        f.push_back(phase->temperature());
+        f.push_back(std::log(phase->pressure()));
+        for (size_t m = 0; m < phase->nElements(); m++) {
+            f.push_back(phase->elementalMassFraction(m));
+        }
+    }
+    vector<size_t> order = zOrder(features);
+
+    unique_ptr<ThreadPool> pool;
+    if (nThreads != 1) {
+        pool = make_unique<ThreadPool>(nThreads);
+    }
+    size_t nWorkers = pool ? pool->size() : 1;
+
+    // Create an independent copy of the phase for each thread; without threads, the
+    // phase of this SolutionArray is used directly
+    vector<shared_ptr<Solution>> phases(nWorkers);
+    vector<unique_ptr<ChemEquil>> equils(nWorkers);
+    for (size_t n = 0; n < nWorkers; n++) {
+        phases[n] = pool ? m_sol->clone() : m_sol;
+        equils[n] = make_unique<ChemEquil>(*phases[n]->thermo());
+        equils[n]->options.contin = true;
+        // Use the same settings as ThermoPhase::equilibrate
+        equils[n]->options.relTolerance = 1e-9;
+        equils[n]->options.maxIterations = 50000;
+    }
+
+    vector<string> solvers(nStates, "failed");
+    vector<long int> iterations(nStates, -1);
+    auto work = [&](size_t i, size_t thread) {
+        size_t loc = order[i];
+        ThermoPhase& thermo = *phases[thread]->thermo();
+        thermo.restoreState(states[loc]);
+        if (solver == "auto" || solver == "element_potential") {
+            ChemEquil& equil = *equils[thread];
+            try {
+                if (equil.equilibrate(thermo, XY.c_str()) >= 0) {
+                    thermo.saveState(states[loc]);
+                    solvers[loc] = "element_potential";
+                    iterations[loc] = equil.options.iterations;
+                    return;
+                }
+            } catch (CanteraError&) {
+            }
+            thermo.restoreState(states[loc]);
+        }
+        for (const string name : {"vcs", "gibbs"}) {
+            if (solver != "auto" && solver != name) {
+                continue;
+            }
+            try {
+                thermo.equilibrate(XY, name);
+                thermo.saveState(states[loc]);
+                solvers[loc] = name;
+                return;
+            } catch (CanteraError&) {
+                thermo.restoreState(states[loc]);
+            }
+        }
+    };
+    if (pool) {
+        pool->parallelFor(nStates, work);
+    } else {
+        for (size_t i = 0; i < nStates; i++) {
+            work(i, 0);
+        }
+    }
+
+    for (size_t i = 0; i < nStates; i++) {
+        setState(static_cast<int>(i), states[i]);
+    }
+    AnyValue column;
+    for (const string name : {"equil-solver", "equil-iterations"}) {
+        if (!hasExtra(name)) {
+            addExtra(name);
+        }
+    }
+    column = solvers;
+    setComponent("equil-solver", column);
+    column = iterations;
+    setComponent("equil-iterations", column);
+}
+
 AnyMap SolutionArray::getAuxiliary(int loc)
 {
     setLoc(loc);
@@ -1169,23 +1330,12 @@ void SolutionArray::writeEntry(const string& fname, const string& name,
         return;
     }
 
+    // state data are written directly from the strided storage buffer
     const auto& nativeState = m_sol->thermo()->nativeState();
     size_t nSpecies = m_sol->thermo()->nSpecies();
     for (auto& [key, offset] : nativeState) {
-        if (key == "X" || key == "Y") {
-            vector<vector<double>> prop;
-            for (size_t i = 0; i < m_size; i++) {
-                size_t first = offset + i * m_stride;
-                prop.emplace_back(m_data->begin() + first,
-                                  m_data->begin() + first + nSpecies);
-            }
-            AnyValue data;
-            data = prop;
-            file.writeData(path, key, data);
-        } else {
-            auto data = getComponent(key);
-            file.writeData(path, key, data);
-        }
+        size_t cols = (key == "X" || key == "Y") ? nSpecies : 0;
+        file.writeData(path, key, m_data->data() + offset, m_dataSize, cols, m_stride);
     }
 
     for (const auto& [key, value] : *m_extra) {
@@ -1201,6 +1351,98 @@ void SolutionArray::writeEntry(const string& fname, const string& name,
     }
 }
 
+size_t SolutionArray::appendEntry(const string& fname, const string& name,
+                                  const string& sub, int compression, size_t chunk)
+{
+    if (name == "") {
+        throw CanteraError("SolutionArray::appendEntry",
+            "Group name specifying root location must not be empty.");
+    }
+    if (apiNdim() > 1) {
+        throw NotImplementedError("SolutionArray::appendEntry",
+            "Unable to append multi-dimensional arrays.");
+    }
+    if (m_size < m_dataSize) {
+        throw NotImplementedError("SolutionArray::appendEntry",
+            "Unable to save sliced data.");
+    }
+    Storage file(fname, true);
+    if (compression) {
+        file.setCompressionLevel(compression);
+    }
+    file.setChunkSize(chunk);
+    if (!file.checkGroup(name, true)) {
+        file.writeAttributes(name, preamble(""));
+    }
+    string path = name;
+    if (sub != "") {
+        path += "/" + sub;
+    } else {
+        path += "/data";
+    }
+    auto components = componentNames();
+    size_t committed = 0;
+    if (file.checkGroup(path, true)) {
+        AnyMap attrs = file.readAttributes(path, false);
+        if (!attrs.hasKey("components")
+            || attrs["components"].asVector<string>() != components)
+        {
+            throw CanteraError("SolutionArray::appendEntry",
+                "Components of existing group '{}' do not match.", path);
+        }
+        if (!attrs.hasKey("size")) {
+            throw CanteraError("SolutionArray::appendEntry",
+                "Existing group '{}' does not hold a committed size.", path);
+        }
+        committed = attrs["size"].as<long int>();
+    } else {
+        file.writeAttributes(path, m_meta);
+        AnyMap more;
+        if (!m_meta.hasKey("transport-model") && m_sol->transport()) {
+            more["transport-model"] = m_sol->transportModel();
+        }
+        more["components"] = components;
+        more["size"] = 0;
+        file.writeAttributes(path, more);
+    }
+
+    // Rows are written starting at the committed size, which discards partial data
+    // left behind by an interrupted call; the size is only updated once all datasets
+    // are complete.
+    const auto& nativeState = m_sol->thermo()->nativeState();
+    size_t nSpecies = m_sol->thermo()->nSpecies();
+    size_t size = committed + m_dataSize;
+    auto checkSize = [&](const string& key, size_t rows) {
+        if (rows != size) {
+            throw CanteraError("SolutionArray::appendEntry",
+                "Inconsistent size of DataSet '{}': expected {} rows but found {}.",
+                key, size, rows);
+        }
+    };
+    for (auto& [key, offset] : nativeState) {
+        size_t cols = (key == "X" || key == "Y") ? nSpecies : 0;
+        checkSize(key, file.appendData(path, key, m_data->data() + offset, m_dataSize,
+                                       cols, m_stride, committed));
+    }
+    for (const auto& [key, value] : *m_extra) {
+        if (value.isVector<double>() || value.isVector<long int>()
+            || value.isVector<string>())
+        {
+            checkSize(key, file.appendData(path, key, value, committed));
+        } else if (value.is<void>()) {
+            // skip unintialized component
+        } else {
+            throw NotImplementedError("SolutionArray::appendEntry",
+                "Unable to append component '{}' with data type {}.",
+                key, value.type_str());
+        }
+    }
+    AnyMap attrs;
+    attrs["size"] = static_cast<long int>(size);
+    file.writeAttributes(path, attrs, true);
+    return size;
+}
+
 void SolutionArray::writeEntry(AnyMap& root, const string& name, const string& sub,
                                bool overwrite)
 {
@@ -1406,9 +1648,12 @@ AnyMap SolutionArray::restore(const string& fname,
     string extension = (dot != npos) ? toLowerCopy(fname.substr(dot + 1)) : "";
     AnyMap header;
     if (extension == "csv") {
-        throw NotImplementedError("SolutionArray::restore",
-            "CSV import not implemented; if using Python, data can be imported via "
-            "'read_csv' instead.");
+        if (name != "") {
+            warn_user("SolutionArray::restore",
+                      "Parameter 'name' not used for CSV input.");
+        }
+        readEntry(fname);
+        return header;
     }
     if (extension == "h5" || extension == "hdf"  || extension == "hdf5") {
         readEntry(fname, name, sub);
@@ -1420,7 +1665,7 @@ AnyMap SolutionArray::restore(const string& fname,
     } else {
         throw CanteraError("SolutionArray::restore",
             "Unknown file extension '{}'; supported extensions include "
-            "'h5'/'hdf'/'hdf5' and 'yml'/'yaml'.", extension);
+            "'h5'/'hdf'/'hdf5', 'yml'/'yaml' and 'csv'.", extension);
     }
     return header;
 }
@@ -1715,76 +1960,47 @@ void SolutionArray::readEntry(const string& fname, const string& name,
     size_t nState = m_sol->thermo()->stateSize();
     const auto& nativeStates = m_sol->thermo()->nativeState();
     if (mode == "native") {
-        // native state can be written directly into data storage
+        // native state can be read directly into data storage
         for (const auto& [name, offset] : nativeStates) {
             if (name == "X" || name == "Y") {
-                AnyValue data;
-                data = file.readData(path, name, m_size, nSpecies);
-                auto prop = data.asVector<vector<double>>();
-                for (size_t i = 0; i < m_dataSize; i++) {
-                    std::copy(prop[i].begin(), prop[i].end(),
-                              m_data->data() + offset + i * m_stride);
-                }
+                file.readData(path, name, m_data->data() + offset, m_dataSize,
+                              nSpecies, m_stride);
             } else {
-                AnyValue data;
-                data = file.readData(path, getName(names, name), m_dataSize, 0);
-                setComponent(name, data);
+                file.readData(path, getName(names, name), m_data->data() + offset,
+                              m_dataSize, 0, m_stride);
             }
         }
-    } else if (mode == "TPX") {
-        AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
-        vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, getName(names, "P"), m_dataSize, 0);
-        vector<double> P = std::move(data.asVector<double>());
-        data = file.readData(path, "X", m_dataSize, nSpecies);
-        vector<vector<double>> X = std::move(data.asVector<vector<double>>());
-        for (size_t i = 0; i < m_dataSize; i++) {
-            m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
-            m_sol->thermo()->setState_TP(T[i], P[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
-        }
-    } else if (mode == "TDX") {
-        AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
-        vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, getName(names, "D"), m_dataSize, 0);
-        vector<double> D = std::move(data.asVector<double>());
-        data = file.readData(path, "X", m_dataSize, nSpecies);
-        vector<vector<double>> X = std::move(data.asVector<vector<double>>());
-        for (size_t i = 0; i < m_dataSize; i++) {
-            m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
-            m_sol->thermo()->setState_TD(T[i], D[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
-        }
-    } else if (mode == "TPY") {
-        AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
-        vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, getName(names, "P"), m_dataSize, 0);
-        vector<double> P = std::move(data.asVector<double>());
-        data = file.readData(path, "Y", m_dataSize, nSpecies);
-        vector<vector<double>> Y = std::move(data.asVector<vector<double>>());
-        for (size_t i = 0; i < m_dataSize; i++) {
-            m_sol->thermo()->setMassFractions_NoNorm(Y[i].data());
-            m_sol->thermo()->setState_TP(T[i], P[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
-        }
-    } else if (mode == "legacySurf") {
-        // erroneous TDX mode (should be TPX or TPY) - Sim1D (Cantera 2.5)
-        AnyValue data;
-        data = file.readData(path, getName(names, "T"), m_dataSize, 0);
-        vector<double> T = std::move(data.asVector<double>());
-        data = file.readData(path, "X", m_dataSize, nSpecies);
-        vector<vector<double>> X = std::move(data.asVector<vector<double>>());
+    } else if (mode == "TPX" || mode == "TDX" || mode == "TPY" || mode == "legacySurf") {
+        vector<double> T(m_dataSize), PD(m_dataSize), XY(m_dataSize * nSpecies);
+        file.readData(path, getName(names, "T"), T.data(), m_dataSize);
+        if (mode != "legacySurf") {
+            string name = getName(names, mode.substr(1, 1));
+            file.readData(path, name, PD.data(), m_dataSize);
+        }
+        string basis = mode == "TPY" ? "Y" : "X";
+        file.readData(path, basis, XY.data(), m_dataSize, nSpecies);
+        auto phase = m_sol->thermo();
         for (size_t i = 0; i < m_dataSize; i++) {
-            m_sol->thermo()->setMoleFractions_NoNorm(X[i].data());
-            m_sol->thermo()->setTemperature(T[i]);
-            m_sol->thermo()->saveState(nState, m_data->data() + i * m_stride);
+            if (basis == "Y") {
+                phase->setMassFractions_NoNorm(XY.data() + i * nSpecies);
+            } else {
+                phase->setMoleFractions_NoNorm(XY.data() + i * nSpecies);
+            }
+            if (mode == "TDX") {
+                phase->setState_TD(T[i], PD[i]);
+            } else if (mode == "legacySurf") {
+                phase->setTemperature(T[i]);
+            } else {
+                phase->setState_TP(T[i], PD[i]);
+            }
+            phase->saveState(nState, m_data->data() + i * m_stride);
+        }
+        if (mode == "legacySurf") {
+            // erroneous TDX mode (should be TPX or TPY) - Sim1D (Cantera 2.5)
+            warn_user("SolutionArray::readEntry",
+                "Detected legacy HDF format with incomplete state information\nfor "
+                "name '{}' (pressure missing).", path);
         }
-        warn_user("SolutionArray::readEntry",
-            "Detected legacy HDF format with incomplete state information\nfor name "
-            "'{}' (pressure missing).", path);
     } else if (mode == "") {
         throw CanteraError("SolutionArray::readEntry",
             "Data are not consistent with full state modes.");
@@ -1826,6 +2042,422 @@ void SolutionArray::readEntry(const string& fname, const string& name,
     }
 }
 
+namespace { // restrict scope of helper functions to local translation unit
+
+//! Split a line of CSV data into fields; quoted fields may contain commas and quotes
+//! escaped by doubling them (RFC 4180), which are unescaped in place
+void splitCsvLine(char* begin, char* end,
+                  vector<pair<const char*, const char*>>& fields)
+{
+    fields.clear();
+    char* pos = begin;
+    while (true) {
+        if (pos < end && *pos == '"') {
+            char* start = pos + 1;
+            char* out = start;
+            char* in = start;
+            while (true) {
+                if (in == end) {
+                    throw CanteraError("SolutionArray::readEntry",
+                        "Unterminated quote in line '{}'.", string(begin, end));
+                }
+                if (*in == '"') {
+                    if (in + 1 < end && in[1] == '"') {
+                        // escaped quote
+                        *out++ = '"';
+                        in += 2;
+                        continue;
+                    }
+                    break;
+                }
+                *out++ = *in++;
+            }
+            fields.emplace_back(start, out);
+            pos = in + 1;
+        } else {
+            char* stop = pos;
+            while (stop < end && *stop != ',') {
+                stop++;
+            }
+            fields.emplace_back(pos, stop);
+            pos = stop;
+        }
+        if (pos == end) {
+            return;
+        }
+        if (*pos != ',') {
+            throw CanteraError("SolutionArray::readEntry",
+                "Unexpected character after quoted field in line '{}'.",
+                string(begin, end));
+        }
+        pos++;
+    }
+}
+
+//! Remove leading and trailing blanks of a CSV field
+void trimCsvField(const char*& begin, const char*& end)
+{
+    while (begin < end && (*begin == ' ' || *begin == '\t')) {
+        begin++;
+    }
+    while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) {
+        end--;
+    }
+}
+
+//! Parse an integer from a CSV field; returns false if the field is not an integer
+bool parseCsvValue(const char* begin, const char* end, long int& value)
+{
+    trimCsvField(begin, end);
+    if (begin < end && *begin == '+') {
+        begin++;
+    }
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    return ec == std::errc() && ptr == end && begin < end;
+}
+
+//! Convert decimal numbers where both the significand and the power of ten are exactly
+//! representable; the result is then correctly rounded (Clinger's fast path). Returns
+//! false if the number cannot be converted this way.
+bool parseExactDouble(const char* begin, const char* end, double& value)
+{
+    static const double pow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const uint64_t maxSignificand = uint64_t(1) << 53;
+    auto isDigit = [](char c) { return static_cast<unsigned>(c - '0') < 10; };
+    const char* pos = begin;
+    bool negative = (pos < end && *pos == '-');
+    if (negative) {
+        pos++;
+    }
+    uint64_t significand = 0;
+    int exponent = 0;
+    bool digits = false;
+    for (; pos < end && isDigit(*pos); pos++) {
+        if (significand > maxSignificand / 10) {
+            return false;
+        }
+        significand = 10 * significand + (*pos - '0');
+        digits = true;
+    }
+    if (pos < end && *pos == '.') {
+        for (pos++; pos < end && isDigit(*pos); pos++) {
+            if (significand > maxSignificand / 10) {
+                return false;
+            }
+            significand = 10 * significand + (*pos - '0');
+            exponent--;
+            digits = true;
+        }
+    }
+    if (!digits || significand > maxSignificand) {
+        return false;
+    }
+    if (pos < end && (*pos == 'e' || *pos == 'E')) {
+        pos++;
+        bool negativeExp = (pos < end && *pos == '-');
+        if (pos < end && (*pos == '-' || *pos == '+')) {
+            pos++;
+        }
+        if (pos == end) {
+            return false;
+        }
+        int exp = 0;
+        for (; pos < end && isDigit(*pos) && exp < 1000; pos++) {
+            exp = 10 * exp + (*pos - '0');
+        }
+        exponent += negativeExp ? -exp : exp;
+    }
+    if (pos != end || exponent < -22 || exponent > 22) {
+        return false;
+    }
+    value = static_cast<double>(significand);
+    value = (exponent < 0) ? value / pow10[-exponent] : value * pow10[exponent];
+    if (negative) {
+        value = -value;
+    }
+    return true;
+}
+
+//! Parse a floating point number from a CSV field using the "C" locale; returns false
+//! if the field is not a number
+bool parseCsvValue(const char* begin, const char* end, double& value)
+{
+    trimCsvField(begin, end);
+    if (begin < end && *begin == '+') {
+        begin++;
+    }
+    if (begin == end) {
+        return false;
+    }
+    if (parseExactDouble(begin, end, value)) {
+        return true;
+    }
+#ifdef __cpp_lib_to_chars
+    auto [ptr, ec] = std::from_chars(begin, end, value);
+    return ec == std::errc() && ptr == end;
+#else
+    // standard library does not provide std::from_chars for floating point numbers
+    std::istringstream ss(string(begin, end));
+    ss.imbue(std::locale("C"));
+    ss >> value;
+    return !ss.fail() && ss.eof();
+#endif
+}
+
+//! Auxiliary data read from a CSV column. The type is inferred from the values: integer
+//! columns are converted to floating point columns, and numeric columns are converted
+//! to string columns if needed.
+struct CsvColumn
+{
+    void append(const char* begin, const char* end) {
+        if (type == Integer) {
+            long int value;
+            if (parseCsvValue(begin, end, value)) {
+                integers.push_back(value);
+                return;
+            }
+            doubles.assign(integers.begin(), integers.end());
+            integers.clear();
+            type = Double;
+        }
+        if (type == Double) {
+            double value;
+            if (parseCsvValue(begin, end, value)) {
+                doubles.push_back(value);
+                return;
+            }
+            for (double v : doubles) {
+                strings.push_back(fmt::format("{}", v));
+            }
+            doubles.clear();
+            type = String;
+        }
+        strings.emplace_back(begin, end);
+    }
+
+    AnyValue value() {
+        AnyValue out;
+        if (type == Integer) {
+            out = std::move(integers);
+        } else if (type == Double) {
+            out = std::move(doubles);
+        } else {
+            out = std::move(strings);
+        }
+        return out;
+    }
+
+    enum { Integer, Double, String } type = Integer;
+    vector<long int> integers;
+    vector<double> doubles;
+    vector<string> strings;
+};
+
+} // end unnamed namespace
+
+void SolutionArray::readEntry(const string& fname)
+{
+    std::ifstream input(fname, std::ios::binary);
+    if (!input.good()) {
+        throw CanteraError("SolutionArray::readEntry",
+            "Unable to open CSV file '{}'.", fname);
+    }
+    setApiShape({0});
+    m_extra->clear();
+    m_order->clear();
+
+    auto phase = m_sol->thermo();
+    size_t nSpecies = phase->nSpecies();
+    size_t nState = phase->stateSize();
+    const auto& nativeState = phase->nativeState();
+
+    // Each state column is assigned to an entry of a row buffer, which either is the
+    // current row of the storage buffer (native mode) or a scratch vector holding
+    // temperature, pressure or density, and species data (other modes).
+    string mode;
+    vector<size_t> stateIndex; // index in row buffer; npos for auxiliary columns
+    vector<size_t> extraIndex; // index in 'columns'; npos for state columns
+    vector<CsvColumn> columns;
+    vector<string> extraNames;
+    bool native = false;
+    vector<double> scratch;
+    vector<pair<const char*, const char*>> fields;
+    size_t nColumns = 0;
+    size_t nRows = 0;
+    size_t line = 0;
+    bool header = true; // the first non-empty line holds column labels
+
+    auto parseHeader = [&]() {
+        nColumns = fields.size();
+        vector<string> labels;
+        string basis;
+        vector<size_t> species(nColumns, npos);
+        set<string> names;
+        for (size_t i = 0; i < nColumns; i++) {
+            auto [begin, end] = fields[i];
+            trimCsvField(begin, end);
+            labels.emplace_back(begin, end);
+            const string& label = labels.back();
+            if (label.size() > 2 && label[1] == '_'
+                && (label[0] == 'X' || label[0] == 'Y'))
+            {
+                species[i] = phase->speciesIndex(label.substr(2));
+            }
+            if (species[i] == npos) {
+                names.insert(label);
+            } else if (basis == "" || basis == label.substr(0, 1)) {
+                basis = label.substr(0, 1);
+            } else {
+                throw CanteraError("SolutionArray::readEntry",
+                    "Species data in file '{}' use mixed mole and mass fraction bases.",
+                    fname);
+            }
+        }
+        if (basis != "") {
+            names.insert(basis);
+        }
+
+        // determine storage mode of state data
+        mode = _detectMode(names);
+        if (mode.size() == 3 && mode[2] == 'C') {
+            // surface phase
+            mode = mode.substr(0, 2) + basis;
+        }
+        map<string, size_t> index;
+        native = mode == "native";
+        if (native) {
+            for (const auto& [name, offset] : nativeState) {
+                if (name == "X" || name == "Y") {
+                    index[name] = offset;
+                } else {
+                    index[getName(names, name)] = offset;
+                }
+            }
+        } else if (mode.substr(0, 2) == "TP" || mode.substr(0, 2) == "TD") {
+            index[getName(names, "T")] = 0;
+            index[getName(names, mode.substr(1, 1))] = 1;
+            if (mode.size() == 3) {
+                index[mode.substr(2, 1)] = 2;
+            }
+            scratch.resize(2 + nSpecies);
+        } else {
+            throw NotImplementedError("SolutionArray::readEntry",
+                "Import of '{}' data is not supported.", mode);
+        }
+
+        // map columns to state data or auxiliary components
+        bool back = false;
+        for (size_t i = 0; i < nColumns; i++) {
+            if (species[i] != npos && index.count(basis)) {
+                stateIndex.push_back(index[basis] + species[i]);
+                extraIndex.push_back(npos);
+                back = true;
+            } else if (species[i] == npos && index.count(labels[i])) {
+                stateIndex.push_back(index[labels[i]]);
+                extraIndex.push_back(npos);
+                back = true;
+            } else {
+                stateIndex.push_back(npos);
+                extraIndex.push_back(columns.size());
+                columns.emplace_back();
+                extraNames.push_back(labels[i]);
+                addExtra(labels[i], back);
+            }
+        }
+    };
+
+    auto parseRow = [&]() {
+        if (fields.size() != nColumns) {
+            throw CanteraError("SolutionArray::readEntry",
+                "Line {} of file '{}' has {} fields, but {} are expected.",
+                line, fname, fields.size(), nColumns);
+        }
+        if ((nRows + 1) * m_stride > m_data->size()) {
+            // grow geometrically; the final size is set once all rows are read
+            m_data->resize(std::max<size_t>(2 * nRows, 64) * m_stride, 0.);
+        }
+        double* row = native ? m_data->data() + nRows * m_stride : scratch.data();
+        for (size_t i = 0; i < nColumns; i++) {
+            auto [begin, end] = fields[i];
+            if (stateIndex[i] != npos) {
+                if (!parseCsvValue(begin, end, row[stateIndex[i]])) {
+                    throw CanteraError("SolutionArray::readEntry",
+                        "Unable to convert '{}' to a number in line {} of file '{}'.",
+                        string(begin, end), line, fname);
+                }
+            } else {
+                columns[extraIndex[i]].append(begin, end);
+            }
+        }
+        if (!native) {
+            if (mode.size() == 3 && mode[2] == 'Y') {
+                phase->setMassFractions_NoNorm(scratch.data() + 2);
+            } else if (mode.size() == 3) {
+                phase->setMoleFractions_NoNorm(scratch.data() + 2);
+            }
+            if (mode[1] == 'D') {
+                phase->setState_TD(scratch[0], scratch[1]);
+            } else {
+                phase->setState_TP(scratch[0], scratch[1]);
+            }
+            phase->saveState(nState, m_data->data() + nRows * m_stride);
+        }
+        nRows++;
+    };
+
+    auto parseLine = [&](char* begin, char* end) {
+        line++;
+        if (end > begin && end[-1] == '\r') {
+            end--;
+        }
+        if (begin == end) {
+            return; // skip empty lines
+        }
+        splitCsvLine(begin, end, fields);
+        if (header) {
+            parseHeader();
+            header = false;
+        } else {
+            parseRow();
+        }
+    };
+
+    // Read file in blocks; lines that are incomplete are carried over to the next block
+    vector<char> buffer(1 << 20);
+    size_t carry = 0;
+    bool done = false;
+    while (!done) {
+        if (carry == buffer.size()) {
+            buffer.resize(2 * buffer.size());
+        }
+        size_t request = buffer.size() - carry;
+        input.read(buffer.data() + carry, request);
+        size_t count = static_cast<size_t>(input.gcount());
+        done = count < request;
+        char* pos = buffer.data();
+        char* end = pos + carry + count;
+        while (auto eol = static_cast<char*>(std::memchr(pos, '\n', end - pos))) {
+            parseLine(pos, eol);
+            pos = eol + 1;
+        }
+        if (done && pos < end) {
+            parseLine(pos, end);
+            pos = end;
+        }
+        carry = end - pos;
+        std::memmove(buffer.data(), pos, carry);
+    }
+
+    resize(static_cast<int>(nRows));
+    if (nRows) {
+        for (size_t j = 0; j < columns.size(); j++) {
+            setComponent(extraNames[j], columns[j].value());
+        }
+    }
+}
+
 void SolutionArray::readEntry(const AnyMap& root, const string& name, const string& sub)
 {
     if (name == "") {
@@ -77,6 +77,14 @@ void Storage::setCompressionLevel(int level)
     m_compressionLevel = level;
 }
 
+void Storage::setChunkSize(size_t rows)
+{
+    if (rows == 0) {
+        throw CanteraError("Storage::setChunkSize", "Chunk size must be positive.");
+    }
+    m_chunkSize = rows;
+}
+
 bool Storage::hasGroup(const string& id) const
 {
     if (!m_file->exist(id)) {
@@ -297,12 +305,18 @@ AnyMap Storage::readAttributes(const string& id, bool recursive) const
     }
 }
 
-void writeH5Attributes(h5::Group sub, const AnyMap& meta)
+void writeH5Attributes(h5::Group sub, const AnyMap& meta, bool overwrite)
 {
     for (auto& [name, item] : meta) {
         if (sub.hasAttribute(name)) {
-            throw NotImplementedError("writeH5Attributes",
-                "Unable to overwrite existing Attribute '{}'", name);
+            if (!overwrite) {
+                throw NotImplementedError("writeH5Attributes",
+                    "Unable to overwrite existing Attribute '{}'", name);
+            }
+            if (H5Adelete(sub.getId(), name.c_str()) < 0) {
+                throw CanteraError("writeH5Attributes",
+                    "Unable to delete existing Attribute '{}'", name);
+            }
         }
         if (item.is<long int>()) {
             int value = item.asInt();
@@ -354,8 +368,9 @@ void writeH5Attributes(h5::Group sub, const AnyMap& meta)
         } else if (item.is<AnyMap>()) {
             // step into recursion
             auto value = item.as<AnyMap>();
-            auto grp = sub.createGroup(name);
-            writeH5Attributes(grp, value);
+            auto grp = (overwrite && sub.exist(name)) ?
+                sub.getGroup(name) : sub.createGroup(name);
+            writeH5Attributes(grp, value, overwrite);
         } else {
             throw NotImplementedError("writeH5Attributes",
                 "Unable to write attribute '{}' with type '{}'",
@@ -364,12 +379,12 @@ void writeH5Attributes(h5::Group sub, const AnyMap& meta)
     }
 }
 
-void Storage::writeAttributes(const string& id, const AnyMap& meta)
+void Storage::writeAttributes(const string& id, const AnyMap& meta, bool overwrite)
 {
     try {
         checkGroupWrite(id, false);
         h5::Group sub = m_file->getGroup(id);
-        writeH5Attributes(sub, meta);
+        writeH5Attributes(sub, meta, overwrite);
     } catch (const Cantera::NotImplementedError& err) {
         throw NotImplementedError("Storage::writeAttribute",
             "{} in group '{}'.", err.getMessage(), id);
@@ -414,7 +429,7 @@ AnyValue Storage::readData(const string& id,
             "Cannot process DataSet '{}' as data has {} dimensions.", name, ndim);
     }
     const auto& shape = space.getDimensions();
-    if (shape[0] != rows) {
+    if (shape[0] < rows) {
         throw CanteraError("Storage::readData",
             "Shape of DataSet '{}' is inconsistent; expected {} rows "
             "but received {}.", name, rows, shape[0]);
@@ -424,17 +439,21 @@ AnyValue Storage::readData(const string& id,
             "Shape of DataSet '{}' is inconsistent; expected {} columns "
             "but received {}.", name, cols, shape[1]);
     }
+    // skip trailing rows, which are not part of the requested data
+    vector<size_t> count = shape;
+    count[0] = rows;
+    auto selection = dataset.select(vector<size_t>(ndim, 0), count);
     AnyValue out;
     const auto datatype = dataset.getDataType().getClass();
     if (datatype == h5::DataTypeClass::Float) {
         try {
             if (ndim == 1) {
                 vector<double> data;
-                dataset.read(data);
+                selection.read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<double>> data;
-                dataset.read(data);
+                selection.read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -446,11 +465,11 @@ AnyValue Storage::readData(const string& id,
         try {
             if (ndim == 1) {
                 vector<long int> data;
-                dataset.read(data);
+                selection.read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<long int>> data;
-                dataset.read(data);
+                selection.read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -462,11 +481,11 @@ AnyValue Storage::readData(const string& id,
         try {
             if (ndim == 1) {
                 vector<string> data;
-                dataset.read(data);
+                selection.read(data);
                 out = data;
             } else { // ndim == 2
                 vector<vector<string>> data;
-                dataset.read(data);
+                selection.read(data);
                 out = data;
             }
         } catch (const std::exception& err) {
@@ -570,6 +589,311 @@ void Storage::writeData(const string& id, const string& name, const AnyValue& da
     }
 }
 
+namespace {
+
+size_t checkStride(const string& method, size_t cols, size_t stride)
+{
+    if (stride == 0) {
+        return std::max<size_t>(cols, 1);
+    } else if (stride < cols) {
+        throw CanteraError(method,
+            "Stride {} is smaller than the number of columns {}.", stride, cols);
+    }
+    return stride;
+}
+
+//! Create memory dataspace selecting *rows* x *cols* entries of a strided buffer, where
+//! row *i* starts at entry `i * stride`; the caller is responsible for closing it.
+hid_t stridedMemSpace(size_t rows, size_t cols, size_t stride)
+{
+    hsize_t dims[2] = {rows, stride};
+    hsize_t origin[2] = {0, 0};
+    hsize_t count[2] = {rows, std::max<hsize_t>(cols, 1)};
+    hid_t space = H5Screate_simple(2, dims, nullptr);
+    if (space < 0) {
+        throw CanteraError("stridedMemSpace", "Unable to create memory dataspace.");
+    }
+    if (H5Sselect_hyperslab(space, H5S_SELECT_SET, origin, nullptr, count,
+                            nullptr) < 0)
+    {
+        H5Sclose(space);
+        throw CanteraError("stridedMemSpace",
+            "Unable to select {} x {} entries of a buffer with stride {}.",
+            rows, cols, stride);
+    }
+    return space;
+}
+
+} // end anonymous namespace
+
+void Storage::readData(const string& id, const string& name, double* data,
+                       size_t rows, size_t cols, size_t stride) const
+{
+    stride = checkStride("Storage::readData", cols, stride);
+    try {
+        checkGroupRead(id);
+    } catch (const CanteraError& err) {
+        throw CanteraError("Storage::readData",
+            "Caught exception for group '{}':\n{}", id, err.getMessage());
+    }
+    h5::Group sub = m_file->getGroup(id);
+    if (!sub.exist(name)) {
+        throw CanteraError("Storage::readData",
+            "DataSet '{}' not found in group '{}'.", name, id);
+    }
+    h5::DataSet dataset = sub.getDataSet(name);
+    h5::DataSpace space = dataset.getSpace();
+    const auto& shape = space.getDimensions();
+    if (shape.size() != (cols ? 2u : 1u)) {
+        throw CanteraError("Storage::readData",
+            "Shape of DataSet '{}' is inconsistent; expected {} dimensions but "
+            "received {}.", name, cols ? 2 : 1, shape.size());
+    }
+    if (shape[0] < rows) {
+        throw CanteraError("Storage::readData",
+            "Shape of DataSet '{}' is inconsistent; expected {} rows "
+            "but received {}.", name, rows, shape[0]);
+    }
+    if (cols && shape[1] != cols) {
+        throw CanteraError("Storage::readData",
+            "Shape of DataSet '{}' is inconsistent; expected {} columns "
+            "but received {}.", name, cols, shape[1]);
+    }
+    const auto datatype = dataset.getDataType().getClass();
+    if (datatype != h5::DataTypeClass::Float && datatype != h5::DataTypeClass::Integer) {
+        throw NotImplementedError("Storage::readData",
+            "DataSet '{}' is not numeric.", name);
+    }
+    if (!rows) {
+        return;
+    }
+    // skip trailing rows, which are not part of the requested data
+    hsize_t start[2] = {0, 0};
+    hsize_t count[2] = {rows, std::max<hsize_t>(cols, 1)};
+    if (H5Sselect_hyperslab(space.getId(), H5S_SELECT_SET, start, nullptr, count,
+                            nullptr) < 0)
+    {
+        throw CanteraError("Storage::readData",
+            "Unable to select rows of DataSet '{}' in group '{}'.", name, id);
+    }
+    hid_t memSpace = stridedMemSpace(rows, cols, stride);
+    herr_t status = H5Dread(dataset.getId(), H5T_NATIVE_DOUBLE, memSpace,
+                            space.getId(), H5P_DEFAULT, data);
+    H5Sclose(memSpace);
+    if (status < 0) {
+        throw CanteraError("Storage::readData",
+            "Unable to read DataSet '{}' in group '{}'.", name, id);
+    }
+}
+
+void Storage::writeData(const string& id, const string& name, const double* data,
+                        size_t rows, size_t cols, size_t stride)
+{
+    stride = checkStride("Storage::writeData", cols, stride);
+    try {
+        checkGroupWrite(id, false);
+    } catch (const CanteraError& err) {
+        // rethrow with public method attribution
+        throw CanteraError("Storage::writeData", "{}", err.getMessage());
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::writeData",
+            "Encountered exception for group '{}':\n{}", id, err.what());
+    }
+    h5::Group sub = m_file->getGroup(id);
+    if (sub.exist(name)) {
+        throw NotImplementedError("Storage::writeData",
+            "Unable to overwrite existing DataSet '{}' in group '{}'.", name, id);
+    }
+    vector<size_t> dims{rows};
+    if (cols) {
+        dims.push_back(cols);
+    }
+    h5::DataSetCreateProps props;
+    if (m_compressionLevel && cols && rows) {
+        // compression is only applied to matrix-type data; see writeData above
+        props.add(h5::Chunking(vector<hsize_t>{rows, cols}));
+        props.add(h5::Deflate(m_compressionLevel));
+    }
+    herr_t status = 0;
+    try {
+        h5::DataSet dataset = sub.createDataSet<double>(name, h5::DataSpace(dims),
+                                                        props);
+        if (!rows) {
+            return;
+        }
+        hid_t memSpace = stridedMemSpace(rows, cols, stride);
+        status = H5Dwrite(dataset.getId(), H5T_NATIVE_DOUBLE, memSpace,
+                          dataset.getSpace().getId(), H5P_DEFAULT, data);
+        H5Sclose(memSpace);
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::writeData",
+            "Encountered exception for DataSet '{}' in group '{}':\n{}",
+            name, id, err.what());
+    }
+    if (status < 0) {
+        throw CanteraError("Storage::writeData",
+            "Unable to write DataSet '{}' in group '{}'.", name, id);
+    }
+}
+
+namespace {
+
+template <typename T>
+h5::DataSet openExtensibleDataSet(h5::Group& sub, const string& name, size_t cols,
+                                  size_t chunk, int compression)
+{
+    if (sub.exist(name)) {
+        h5::DataSet dataset = sub.getDataSet(name);
+        h5::DataSpace space = dataset.getSpace();
+        const auto& dims = space.getDimensions();
+        if (dims.size() != (cols ? 2u : 1u) || (cols && dims[1] != cols)) {
+            throw CanteraError("Storage::appendData",
+                "Shape of existing DataSet '{}' is inconsistent with appended data.",
+                name);
+        }
+        if (space.getMaxDimensions()[0] != h5::DataSpace::UNLIMITED) {
+            throw CanteraError("Storage::appendData",
+                "Existing DataSet '{}' is not extensible.", name);
+        }
+        return dataset;
+    }
+    vector<size_t> dims{0};
+    vector<size_t> maxDims{h5::DataSpace::UNLIMITED};
+    vector<hsize_t> chunkDims{chunk};
+    if (cols) {
+        dims.push_back(cols);
+        maxDims.push_back(cols);
+        chunkDims.push_back(cols);
+    }
+    h5::DataSetCreateProps props;
+    props.add(h5::Chunking(chunkDims));
+    if (compression) {
+        props.add(h5::Deflate(compression));
+    }
+    return sub.createDataSet<T>(name, h5::DataSpace(dims, maxDims), props);
+}
+
+//! Determine the row where appended data start and discard any rows beyond it
+size_t appendOffset(h5::DataSet& dataset, const string& name, size_t offset)
+{
+    auto dims = dataset.getSpace().getDimensions();
+    if (offset == npos) {
+        return dims[0];
+    } else if (offset > dims[0]) {
+        throw CanteraError("Storage::appendData",
+            "Offset {} exceeds the number of rows {} of DataSet '{}'.",
+            offset, dims[0], name);
+    } else if (offset < dims[0]) {
+        dims[0] = offset;
+        dataset.resize(dims);
+    }
+    return offset;
+}
+
+template <typename T>
+size_t appendH5Data(h5::Group& sub, const string& name, const T* data, size_t rows,
+                    size_t cols, size_t stride, size_t offset, size_t chunk,
+                    int compression)
+{
+    h5::DataSet dataset = openExtensibleDataSet<T>(sub, name, cols, chunk, compression);
+    offset = appendOffset(dataset, name, offset);
+    if (!rows) {
+        return offset;
+    }
+    vector<size_t> dims{offset + rows};
+    if (cols) {
+        dims.push_back(cols);
+    }
+    dataset.resize(dims);
+
+    // select destination rows within file and source entries within strided buffer
+    hsize_t start[2] = {offset, 0};
+    hsize_t count[2] = {rows, std::max<hsize_t>(cols, 1)};
+    h5::DataSpace fileSpace = dataset.getSpace();
+    if (H5Sselect_hyperslab(fileSpace.getId(), H5S_SELECT_SET, start, nullptr, count,
+                            nullptr) < 0)
+    {
+        throw CanteraError("Storage::appendData",
+            "Unable to select rows to append to DataSet '{}'.", name);
+    }
+    hid_t memSpace = stridedMemSpace(rows, cols, stride);
+    herr_t status = H5Dwrite(dataset.getId(), h5::AtomicType<T>().getId(), memSpace,
+                             fileSpace.getId(), H5P_DEFAULT, data);
+    H5Sclose(memSpace);
+    if (status < 0) {
+        throw CanteraError("Storage::appendData",
+            "Unable to append data to DataSet '{}'.", name);
+    }
+    return offset + rows;
+}
+
+} // end anonymous namespace
+
+size_t Storage::appendData(const string& id, const string& name, const double* data,
+                           size_t rows, size_t cols, size_t stride, size_t offset)
+{
+    stride = checkStride("Storage::appendData", cols, stride);
+    try {
+        checkGroupWrite(id, false);
+        h5::Group sub = m_file->getGroup(id);
+        return appendH5Data(sub, name, data, rows, cols, stride, offset,
+                            m_chunkSize, m_compressionLevel);
+    } catch (const CanteraError& err) {
+        // rethrow with public method attribution
+        throw CanteraError("Storage::appendData", "{}", err.getMessage());
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered exception for DataSet '{}' in group '{}':\n{}",
+            name, id, err.what());
+    }
+}
+
+size_t Storage::appendData(const string& id, const string& name, const AnyValue& data,
+                           size_t offset)
+{
+    if (!data.isVector<double>() && !data.isVector<long int>()
+        && !data.isVector<string>())
+    {
+        throw NotImplementedError("Storage::appendData",
+            "Cannot append to DataSet '{}' in group '{}' as input data with type\n"
+            "'{}'\nis not supported.", name, id, data.type_str());
+    }
+    try {
+        checkGroupWrite(id, false);
+        h5::Group sub = m_file->getGroup(id);
+        if (data.isVector<double>()) {
+            const auto& values = data.asVector<double>();
+            return appendH5Data(sub, name, values.data(), values.size(), 0, 1, offset,
+                                m_chunkSize, m_compressionLevel);
+        } else if (data.isVector<long int>()) {
+            const auto& values = data.asVector<long int>();
+            return appendH5Data(sub, name, values.data(), values.size(), 0, 1, offset,
+                                m_chunkSize, m_compressionLevel);
+        }
+        // variable-length strings are not stored contiguously
+        const auto& values = data.asVector<string>();
+        h5::DataSet dataset = openExtensibleDataSet<string>(
+            sub, name, 0, m_chunkSize, m_compressionLevel);
+        offset = appendOffset(dataset, name, offset);
+        if (values.size()) {
+            dataset.resize({offset + values.size()});
+            dataset.select({offset}, {values.size()}).write(values);
+        }
+        return offset + values.size();
+    } catch (const CanteraError& err) {
+        // rethrow with public method attribution
+        throw CanteraError("Storage::appendData", "{}", err.getMessage());
+    } catch (const std::exception& err) {
+        // convert HighFive exception
+        throw CanteraError("Storage::appendData",
+            "Encountered exception for DataSet '{}' in group '{}':\n{}",
+            name, id, err.what());
+    }
+}
+
 #else
 
 Storage::Storage(string fname, bool write)
@@ -588,6 +912,12 @@ void Storage::setCompressionLevel(int level)
                        "Saving to HDF requires HighFive installation.");
 }
 
+void Storage::setChunkSize(size_t rows)
+{
+    throw CanteraError("Storage::setChunkSize",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 bool Storage::hasGroup(const string& id) const
 {
     throw CanteraError("Storage::hasGroup",
@@ -624,7 +954,7 @@ AnyMap Storage::readAttributes(const string& id, bool recursive) const
                        "Saving to HDF requires HighFive installation.");
 }
 
-void Storage::writeAttributes(const string& id, const AnyMap& meta)
+void Storage::writeAttributes(const string& id, const AnyMap& meta, bool overwrite)
 {
     throw CanteraError("Storage::writeAttributes",
                        "Saving to HDF requires HighFive installation.");
@@ -644,6 +974,34 @@ void Storage::writeData(const string& id,
                        "Saving to HDF requires HighFive installation.");
 }
 
+void Storage::readData(const string& id, const string& name, double* data,
+                       size_t rows, size_t cols, size_t stride) const
+{
+    throw CanteraError("Storage::readData",
+                       "Saving to HDF requires HighFive installation.");
+}
+
+void Storage::writeData(const string& id, const string& name, const double* data,
+                        size_t rows, size_t cols, size_t stride)
+{
+    throw CanteraError("Storage::writeData",
+                       "Saving to HDF requires HighFive installation.");
+}
+
+size_t Storage::appendData(const string& id, const string& name, const double* data,
+                           size_t rows, size_t cols, size_t stride, size_t offset)
+{
+    throw CanteraError("Storage::appendData",
+                       "Saving to HDF requires HighFive installation.");
+}
+
+size_t Storage::appendData(const string& id, const string& name, const AnyValue& data,
+                           size_t offset)
+{
+    throw CanteraError("Storage::appendData",
+                       "Saving to HDF requires HighFive installation.");
+}
+
 #endif
 
 }
@@ -0,0 +1,100 @@
+//! @file ThreadPool.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/base/ThreadPool.h"
+
+namespace Cantera
+{
+
+ThreadPool::ThreadPool(size_t nThreads)
+{
+    if (nThreads == 0) {
+        nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    m_errors.resize(nThreads);
+    for (size_t i = 1; i < nThreads; i++) {
+        m_workers.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(size_t n, const std::function<void(size_t, size_t)>& func)
+{
+    if (m_workers.empty() || n < 2) {
+        for (size_t i = 0; i < n; i++) {
+            func(i, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &func;
+        m_n = n;
+        m_pending = m_workers.size();
+        std::fill(m_errors.begin(), m_errors.end(), nullptr);
+        m_generation++;
+    }
+    m_start.notify_all();
+    runBlock(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_pending == 0; });
+    m_task = nullptr;
+    for (auto& err : m_errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+}
+
+void ThreadPool::work(size_t thread)
+{
+    size_t generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [&]() {
+                return m_stop || m_generation != generation;
+            });
+            if (m_stop) {
+                return;
+            }
+            generation = m_generation;
+        }
+        runBlock(thread);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending--;
+        }
+        m_done.notify_one();
+    }
+}
+
+void ThreadPool::runBlock(size_t thread)
+{
+    size_t start = m_n * thread / size();
+    size_t stop = m_n * (thread + 1) / size();
+    try {
+        for (size_t i = start; i < stop; i++) {
+            (*m_task)(i, thread);
+        }
+    } catch (...) {
+        m_errors[thread] = std::current_exception();
+    }
+}
+
+}
@@ -35,6 +35,12 @@ static std::mutex dir_mutex;
 //! Mutex for creating singletons within the application object
 static std::mutex app_mutex;
 
+//! Mutex for access to the set of emitted deprecation warnings
+static std::mutex warn_mutex;
+
+//! Mutex for loading extensions
+static std::mutex ext_mutex;
+
 void Application::Messages::addError(const string& r, const string& msg)
 {
     if (msg.size() != 0) {
@@ -89,30 +95,39 @@ Application::Application()
 
 Application* Application::Instance()
 {
+    // Fast path without locking once the Application object exists
+    Application* app = s_app.load(std::memory_order_acquire);
+    if (app) {
+        return app;
+    }
     std::unique_lock<std::mutex> appLock(app_mutex);
-    if (Application::s_app == 0) {
-        Application::s_app = new Application();
+    app = s_app.load(std::memory_order_relaxed);
+    if (!app) {
+        app = new Application();
+        s_app.store(app, std::memory_order_release);
     }
-    return s_app;
+    return app;
 }
 
 void Application::ApplicationDestroy()
 {
     std::unique_lock<std::mutex> appLock(app_mutex);
-    if (Application::s_app != 0) {
-        delete Application::s_app;
-        Application::s_app = 0;
-    }
+    delete s_app.exchange(nullptr);
 }
 
 void Application::warn_deprecated(const string& method, const string& extra)
 {
     if (m_fatal_deprecation_warnings) {
         throw CanteraError(method, "Deprecated: " + extra);
-    } else if (m_suppress_deprecation_warnings || warnings.count(method)) {
+    } else if (m_suppress_deprecation_warnings) {
         return;
     }
-    warnings.insert(method);
+    {
+        std::unique_lock<std::mutex> warnLock(warn_mutex);
+        if (!warnings.insert(method).second) {
+            return;
+        }
+    }
     warnlog("Deprecation", fmt::format("{}: {}", method, extra));
 }
 
@@ -382,6 +397,7 @@ void Application::loadExtension(const string& extType, const string& name)
             "Loading extensions requires linking to the Cantera shared library\n"
             "rather than the static library");
     }
+    std::unique_lock<std::mutex> extLock(ext_mutex);
     if (m_loaded_extensions.count({extType, name})) {
         return;
     }
@@ -430,6 +446,6 @@ void Application::searchPythonVersions(const string& versions) {
     ba::split(m_pythonSearchVersions, versions, ba::is_any_of(","));
 }
 
-Application* Application::s_app = 0;
+std::atomic<Application*> Application::s_app = nullptr;
 
 } // namespace Cantera
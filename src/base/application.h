@@ -11,6 +11,7 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include <atomic>
 #include <thread>
 
 namespace Cantera
@@ -427,12 +428,12 @@ protected:
     //! Set of deprecation warnings that have been emitted (to suppress duplicates)
     set<string> warnings;
 
-    bool m_suppress_deprecation_warnings = false;
-    bool m_fatal_deprecation_warnings = false;
-    bool m_suppress_thermo_warnings = false;
-    bool m_suppress_warnings = false;
-    bool m_fatal_warnings = false;
-    bool m_use_legacy_rate_constants = false;
+    std::atomic<bool> m_suppress_deprecation_warnings = false;
+    std::atomic<bool> m_fatal_deprecation_warnings = false;
+    std::atomic<bool> m_suppress_thermo_warnings = false;
+    std::atomic<bool> m_suppress_warnings = false;
+    std::atomic<bool> m_fatal_warnings = false;
+    std::atomic<bool> m_use_legacy_rate_constants = false;
 
     set<pair<string, string>> m_loaded_extensions;
 
@@ -443,7 +444,7 @@ protected:
 
 private:
     //! Pointer to the single Application instance
-    static Application* s_app;
+    static std::atomic<Application*> s_app;
 };
 
 }
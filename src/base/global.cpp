@@ -218,10 +218,11 @@ bool usesHDF5()
 }
 
 vector<FactoryBase*> FactoryBase::s_vFactoryRegistry;
+std::mutex FactoryBase::s_registryMutex;
 
 string demangle(const std::type_info& type)
 {
-    static map<string, string> typenames = {
+    static const map<string, string> typenames = {
         {typeid(void).name(), "void"},
         {typeid(double).name(), "double"},
         {typeid(long int).name(), "long int"},
@@ -240,8 +241,9 @@ string demangle(const std::type_info& type)
         {typeid(AnyMap).name(), "AnyMap"},
     };
 
-    if (typenames.count(type.name())) {
-        return typenames[type.name()];
+    auto iter = typenames.find(type.name());
+    if (iter != typenames.end()) {
+        return iter->second;
     } else {
         return boost::core::demangle(type.name());
     }
@@ -10,6 +10,7 @@
 
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/utilities.h"
+#include <mutex>
 #include <unordered_map>
 #include <boost/range/adaptor/reversed.hpp>
 
@@ -46,6 +47,10 @@ namespace Cantera {
  * called to obtain a pointer to the instance. This function calls the constructor on
  * the first call and stores the pointer to this instance. Subsequent calls simply
  * return the already-created pointer.
+ *
+ * All operations on a Cabinet<M> are serialized by a mutex, so objects may be added,
+ * accessed and deleted from multiple threads. Method 'at' returns a copy of the
+ * stored shared pointer, which remains valid while other threads modify the Cabinet.
  */
 template<class M>
 class Cabinet
@@ -63,6 +68,7 @@ public:
      * Add a new object. The index of the object is returned.
      */
     static int add(shared_ptr<M> obj, int parent=-1) {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         dataRef data = getData();
         data.push_back(obj);
         auto& parents = getParents();
@@ -81,6 +87,7 @@ public:
      * Return cabinet size.
      */
     static int size() {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         return static_cast<int>(getData().size());
     }
 
@@ -88,6 +95,7 @@ public:
      * Delete all objects without erasing mapping.
      */
     static int clear() {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         dataRef data = getData();
         for (size_t i = 0; i < data.size(); i++) {
             del(static_cast<int>(i));
@@ -99,6 +107,7 @@ public:
      * Delete all objects and erase mapping.
      */
     static int reset() {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         getData().clear();
         getParents().clear();
         getLookup().clear();
@@ -109,6 +118,7 @@ public:
      * Add a copy of the nth object to storage. The index of the new entry is returned.
      */
     static int copy(int n) {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         dataRef data = getData();
         try {
             return add(*data[n]);  // do not copy parent to avoid ambiguous data
@@ -121,6 +131,7 @@ public:
      * Delete the nth object.
      */
     static void del(int n) {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         dataRef data = getData();
         if (n >= 0 && n < len(data)) {
             lookupRef lookup = getLookup();
@@ -146,6 +157,7 @@ public:
      * Return handle of parent to object n.
      */
     static int parent(int n) {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         auto& parents = getParents();
         if (n < 0 || n >= len(parents)) {
             throw CanteraError("Cabinet::parent", "Index {} out of range.", n);
@@ -156,7 +168,8 @@ public:
     /**
      * Return a shared pointer to object n.
      */
-    static shared_ptr<M>& at(int n) {
+    static shared_ptr<M> at(int n) {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         dataRef data = getData();
         if (n < 0 || n >= len(data)) {
             throw CanteraError("Cabinet::at", "Index {} out of range.", n);
@@ -186,6 +199,7 @@ public:
      * object, the index of the last one added is returned.
      */
     static int index(const M& obj, int parent=-1) {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
         lookupRef lookup = getLookup();
         if (!lookup.count(&obj)) {
             return -1;
@@ -201,6 +215,15 @@ public:
     }
 
 private:
+    /**
+     * Static function that returns the mutex guarding the singleton Cabinet<M>
+     * instance. A recursive mutex is used since some member functions call others.
+     */
+    static std::recursive_mutex& mutex() {
+        static std::recursive_mutex s_mutex;
+        return s_mutex;
+    }
+
     /**
      * Static function that returns a pointer to the data member of
      * the singleton Cabinet<M> instance. All member functions should
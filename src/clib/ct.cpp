@@ -349,7 +349,7 @@ extern "C" {
     int thermo_getMoleFractions(int n, size_t lenx, double* x)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->checkSpeciesArraySize(lenx);
             p->getMoleFractions(x);
             return 0;
@@ -370,7 +370,7 @@ extern "C" {
     int thermo_getMassFractions(int n, size_t leny, double* y)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->checkSpeciesArraySize(leny);
             p->getMassFractions(y);
             return 0;
@@ -391,7 +391,7 @@ extern "C" {
     int thermo_setMoleFractions(int n, size_t lenx, double* x, int norm)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->checkSpeciesArraySize(lenx);
             if (norm) {
                 p->setMoleFractions(x);
@@ -407,7 +407,7 @@ extern "C" {
     int thermo_setMoleFractionsByName(int n, const char* x)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->setMoleFractionsByName(x);
             return 0;
         } catch (...) {
@@ -419,7 +419,7 @@ extern "C" {
                                double* y, int norm)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->checkSpeciesArraySize(leny);
             if (norm) {
                 p->setMassFractions(y);
@@ -435,7 +435,7 @@ extern "C" {
     int thermo_setMassFractionsByName(int n, const char* y)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->setMassFractionsByName(y);
             return 0;
         } catch (...) {
@@ -446,7 +446,7 @@ extern "C" {
     int thermo_getAtomicWeights(int n, size_t lenm, double* atw)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->checkElementArraySize(lenm);
             const vector<double>& wt = p->atomicWeights();
             copy(wt.begin(), wt.end(), atw);
@@ -459,7 +459,7 @@ extern "C" {
     int thermo_getMolecularWeights(int n, size_t lenm, double* mw)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->checkSpeciesArraySize(lenm);
             const vector<double>& wt = p->molecularWeights();
             copy(wt.begin(), wt.end(), mw);
@@ -472,7 +472,7 @@ extern "C" {
     int thermo_getCharges(int n, size_t lenm, double* sc)
     {
         try {
-            auto& p = ThermoCabinet::at(n);
+            auto p = ThermoCabinet::at(n);
             p->checkSpeciesArraySize(lenm);
             p->getCharges(sc);
             return 0;
@@ -677,7 +677,7 @@ extern "C" {
     int thermo_chemPotentials(int n, size_t lenm, double* murt)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getChemPotentials(murt);
             return 0;
@@ -689,7 +689,7 @@ extern "C" {
     int thermo_electrochemPotentials(int n, size_t lenm, double* emu)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getElectrochemPotentials(emu);
             return 0;
@@ -890,7 +890,7 @@ extern "C" {
     double thermo_minTemp(int n, int k)
     {
         try {
-            auto& ph = ThermoCabinet::at(n);
+            auto ph = ThermoCabinet::at(n);
             if (k != -1) {
                 ph->checkSpeciesIndex(k);
                 return ph->minTemp(k);
@@ -905,7 +905,7 @@ extern "C" {
     double thermo_maxTemp(int n, int k)
     {
         try {
-            auto& ph = ThermoCabinet::at(n);
+            auto ph = ThermoCabinet::at(n);
             if (k != -1) {
                 ph->checkSpeciesIndex(k);
                 return ph->maxTemp(k);
@@ -921,7 +921,7 @@ extern "C" {
     int thermo_getEnthalpies_RT(int n, size_t lenm, double* h_rt)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getEnthalpy_RT_ref(h_rt);
             return 0;
@@ -933,7 +933,7 @@ extern "C" {
     int thermo_getEntropies_R(int n, size_t lenm, double* s_r)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getEntropy_R_ref(s_r);
             return 0;
@@ -945,7 +945,7 @@ extern "C" {
     int thermo_getCp_R(int n, size_t lenm, double* cp_r)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getCp_R_ref(cp_r);
             return 0;
@@ -967,7 +967,7 @@ extern "C" {
     int thermo_getPartialMolarEnthalpies(int n, size_t lenm, double* pmh)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getPartialMolarEnthalpies(pmh);
             return 0;
@@ -979,7 +979,7 @@ extern "C" {
     int thermo_getPartialMolarEntropies(int n, size_t lenm, double* pms)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getPartialMolarEntropies(pms);
             return 0;
@@ -991,7 +991,7 @@ extern "C" {
     int thermo_getPartialMolarIntEnergies(int n, size_t lenm, double* pmu)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getPartialMolarIntEnergies(pmu);
             return 0;
@@ -1003,7 +1003,7 @@ extern "C" {
     int thermo_getPartialMolarCp(int n, size_t lenm, double* pmcp)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getPartialMolarCp(pmcp);
             return 0;
@@ -1015,7 +1015,7 @@ extern "C" {
     int thermo_getPartialMolarVolumes(int n, size_t lenm, double* pmv)
     {
         try {
-            auto& thrm = ThermoCabinet::at(n);
+            auto thrm = ThermoCabinet::at(n);
             thrm->checkSpeciesArraySize(lenm);
             thrm->getPartialMolarVolumes(pmv);
             return 0;
@@ -1193,7 +1193,7 @@ extern "C" {
     double kin_reactantStoichCoeff(int n, int k, int i)
     {
         try {
-            auto& kin = KineticsCabinet::at(n);
+            auto kin = KineticsCabinet::at(n);
             kin->checkSpeciesIndex(k);
             kin->checkReactionIndex(i);
             return kin->reactantStoichCoeff(k,i);
@@ -1205,7 +1205,7 @@ extern "C" {
     double kin_productStoichCoeff(int n, int k, int i)
     {
         try {
-            auto& kin = KineticsCabinet::at(n);
+            auto kin = KineticsCabinet::at(n);
             kin->checkSpeciesIndex(k);
             kin->checkReactionIndex(i);
             return kin->productStoichCoeff(k,i);
@@ -1217,7 +1217,7 @@ extern "C" {
     int kin_getReactionType(int n, int i, size_t len, char* buf)
     {
         try {
-            auto& kin = KineticsCabinet::at(n);
+            auto kin = KineticsCabinet::at(n);
             kin->checkReactionIndex(i);
             return static_cast<int>(copyString(kin->reaction(i)->type(), buf, len));
         } catch (...) {
@@ -1228,7 +1228,7 @@ extern "C" {
     int kin_getFwdRatesOfProgress(int n, size_t len, double* fwdROP)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionArraySize(len);
             k->getFwdRatesOfProgress(fwdROP);
             return 0;
@@ -1240,7 +1240,7 @@ extern "C" {
     int kin_getRevRatesOfProgress(int n, size_t len, double* revROP)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionArraySize(len);
             k->getRevRatesOfProgress(revROP);
             return 0;
@@ -1252,7 +1252,7 @@ extern "C" {
     int kin_isReversible(int n, int i)
     {
         try {
-            auto& kin = KineticsCabinet::at(n);
+            auto kin = KineticsCabinet::at(n);
             kin->checkReactionIndex(i);
             return (int) kin->isReversible(i);
         } catch (...) {
@@ -1263,7 +1263,7 @@ extern "C" {
     int kin_getNetRatesOfProgress(int n, size_t len, double* netROP)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionArraySize(len);
             k->getNetRatesOfProgress(netROP);
             return 0;
@@ -1275,7 +1275,7 @@ extern "C" {
     int kin_getFwdRateConstants(int n, size_t len, double* kfwd)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionArraySize(len);
             k->getFwdRateConstants(kfwd);
             return 0;
@@ -1287,7 +1287,7 @@ extern "C" {
     int kin_getRevRateConstants(int n, int doIrreversible, size_t len, double* krev)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionArraySize(len);
             k->getRevRateConstants(krev, doIrreversible != 0);
             return 0;
@@ -1299,7 +1299,7 @@ extern "C" {
     int kin_getDelta(int n, int job, size_t len, double* delta)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionArraySize(len);
             switch (job) {
             case 0:
@@ -1332,7 +1332,7 @@ extern "C" {
     int kin_getCreationRates(int n, size_t len, double* cdot)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkSpeciesArraySize(len);
             k->getCreationRates(cdot);
             return 0;
@@ -1344,7 +1344,7 @@ extern "C" {
     int kin_getDestructionRates(int n, size_t len, double* ddot)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkSpeciesArraySize(len);
             k->getDestructionRates(ddot);
             return 0;
@@ -1356,7 +1356,7 @@ extern "C" {
     int kin_getNetProductionRates(int n, size_t len, double* wdot)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkSpeciesArraySize(len);
             k->getNetProductionRates(wdot);
             return 0;
@@ -1369,7 +1369,7 @@ extern "C" {
     {
         try {
             // @todo This function only works for single phase kinetics
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             ThermoPhase& p = k->thermo();
             size_t nsp = p.nSpecies();
             k->checkSpeciesArraySize(len);
@@ -1388,7 +1388,7 @@ extern "C" {
     double kin_multiplier(int n, int i)
     {
         try {
-            auto& kin = KineticsCabinet::at(n);
+            auto kin = KineticsCabinet::at(n);
             kin->checkReactionIndex(i);
             return kin->multiplier(i);
         } catch (...) {
@@ -1399,7 +1399,7 @@ extern "C" {
     size_t kin_phase(int n, size_t i)
     {
         try {
-            auto& kin = KineticsCabinet::at(n);
+            auto kin = KineticsCabinet::at(n);
             kin->checkPhaseIndex(i);
             return ThermoCabinet::index(kin->thermo(i));
         } catch (...) {
@@ -1410,7 +1410,7 @@ extern "C" {
     int kin_getEquilibriumConstants(int n, size_t len, double* kc)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionArraySize(len);
             k->getEquilibriumConstants(kc);
             return 0;
@@ -1422,7 +1422,7 @@ extern "C" {
     int kin_getReactionString(int n, int i, int len, char* buf)
     {
         try {
-            auto& k = KineticsCabinet::at(n);
+            auto k = KineticsCabinet::at(n);
             k->checkReactionIndex(i);
             return static_cast<int>(copyString(k->reaction(i)->equation(), buf, len));
         } catch (...) {
@@ -1434,7 +1434,7 @@ extern "C" {
     {
         try {
             if (v >= 0.0) {
-                auto& kin = KineticsCabinet::at(n);
+                auto kin = KineticsCabinet::at(n);
                 kin->checkReactionIndex(i);
                 kin->setMultiplier(i,v);
                 return 0;
@@ -1498,7 +1498,7 @@ extern "C" {
     int trans_getThermalDiffCoeffs(int n, int ldt, double* dt)
     {
         try {
-            auto& tr = TransportCabinet::at(n);
+            auto tr = TransportCabinet::at(n);
             tr->checkSpeciesArraySize(ldt);
             tr->getThermalDiffCoeffs(dt);
             return 0;
@@ -1510,7 +1510,7 @@ extern "C" {
     int trans_getMixDiffCoeffs(int n, int ld, double* d)
     {
         try {
-            auto& tr = TransportCabinet::at(n);
+            auto tr = TransportCabinet::at(n);
             tr->checkSpeciesArraySize(ld);
             tr->getMixDiffCoeffs(d);
             return 0;
@@ -1523,7 +1523,7 @@ extern "C" {
     {
         try {
             // @todo length of d should be passed for bounds checking
-            auto& tr = TransportCabinet::at(n);
+            auto tr = TransportCabinet::at(n);
             tr->checkSpeciesArraySize(ld);
             tr->getBinaryDiffCoeffs(ld,d);
             return 0;
@@ -1536,7 +1536,7 @@ extern "C" {
     {
         try {
             // @todo length of d should be passed for bounds checking
-            auto& tr = TransportCabinet::at(n);
+            auto tr = TransportCabinet::at(n);
             tr->checkSpeciesArraySize(ld);
             tr->getMultiDiffCoeffs(ld,d);
             return 0;
@@ -111,7 +111,7 @@ extern "C" {
     size_t mix_speciesIndex(int i, int k, int p)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkPhaseIndex(p);
             mix->checkSpeciesIndex(k);
             return mix->speciesIndex(k, p);
@@ -123,7 +123,7 @@ extern "C" {
     double mix_nAtoms(int i, int k, int m)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkSpeciesIndex(k);
             mix->checkElementIndex(m);
             return mixCabinet::at(i)->nAtoms(k,m);
@@ -144,7 +144,7 @@ extern "C" {
     double mix_phaseMoles(int i, int n)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkPhaseIndex(n);
             return mix->phaseMoles(n);
         } catch (...) {
@@ -155,7 +155,7 @@ extern "C" {
     int mix_setPhaseMoles(int i, int n, double v)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkPhaseIndex(n);
             if (v < 0.0) {
                 throw CanteraError("mix_setPhaseMoles",
@@ -171,7 +171,7 @@ extern "C" {
     int mix_setMoles(int i, size_t nlen, const double* n)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkSpeciesArraySize(nlen);
             mix->setMoles(n);
             return 0;
@@ -244,7 +244,7 @@ extern "C" {
     double mix_phaseCharge(int i, int p)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkPhaseIndex(p);
             return mix->phaseCharge(p);
         } catch (...) {
@@ -278,7 +278,7 @@ extern "C" {
     double mix_speciesMoles(int i, int k)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkSpeciesIndex(k);
             return mix->speciesMoles(k);
         } catch (...) {
@@ -289,7 +289,7 @@ extern "C" {
     double mix_elementMoles(int i, int m)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkElementIndex(m);
             return mix->elementMoles(m);
         } catch (...) {
@@ -312,7 +312,7 @@ extern "C" {
     int mix_getChemPotentials(int i, size_t lenmu, double* mu)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkSpeciesArraySize(lenmu);
             mix->getChemPotentials(mu);
             return 0;
@@ -369,7 +369,7 @@ extern "C" {
     size_t mix_speciesPhaseIndex(int i, int k)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkSpeciesIndex(k);
             return mix->speciesPhaseIndex(k);
         } catch (...) {
@@ -380,7 +380,7 @@ extern "C" {
     double mix_moleFraction(int i, int k)
     {
         try {
-            auto& mix = mixCabinet::at(i);
+            auto mix = mixCabinet::at(i);
             mix->checkSpeciesIndex(k);
             return mix->moleFraction(k);
         } catch (...) {
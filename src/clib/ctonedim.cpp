@@ -50,7 +50,7 @@ extern "C" {
     int domain_new(const char* type, int i, const char* id)
     {
         try {
-            auto& soln = SolutionCabinet::at(i);
+            auto soln = SolutionCabinet::at(i);
             auto d = newDomain(type, soln, id);
             return DomainCabinet::add(d);
         } catch (...) {
@@ -107,7 +107,7 @@ extern "C" {
     int domain_componentName(int i, int n, int sz, char* buf)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             return static_cast<int>(copyString(dom->componentName(n), buf, sz));
         } catch (...) {
@@ -127,7 +127,7 @@ extern "C" {
     double domain_grid(int i, int n)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkPointIndex(n);
             return dom->z(n);
         } catch (...) {
@@ -138,7 +138,7 @@ extern "C" {
     int domain_setBounds(int i, int n, double lower, double upper)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             dom->setBounds(n, lower, upper);
             return 0;
@@ -150,7 +150,7 @@ extern "C" {
     double domain_upperBound(int i, int n)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             return dom->upperBound(n);
         } catch (...) {
@@ -161,7 +161,7 @@ extern "C" {
     double domain_lowerBound(int i, int n)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             return dom->lowerBound(n);
         } catch (...) {
@@ -173,7 +173,7 @@ extern "C" {
                                    double atol)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             dom->setSteadyTolerances(rtol, atol, n);
             return 0;
@@ -186,7 +186,7 @@ extern "C" {
                                       double atol)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             dom->setTransientTolerances(rtol, atol, n);
             return 0;
@@ -198,7 +198,7 @@ extern "C" {
     double domain_rtol(int i, int n)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             return dom->rtol(n);
         } catch (...) {
@@ -209,7 +209,7 @@ extern "C" {
     double domain_atol(int i, int n)
     {
         try {
-            auto& dom = DomainCabinet::at(i);
+            auto dom = DomainCabinet::at(i);
             dom->checkComponentIndex(n);
             return dom->atol(n);
         } catch (...) {
@@ -328,7 +328,7 @@ extern "C" {
     int flow1D_new(int iph, int ikin, int itr, int itype)
     {
         try {
-            auto& ph = ThermoCabinet::at(iph);
+            auto ph = ThermoCabinet::at(iph);
             auto x = make_shared<Flow1D>(ph, ph->nSpecies(), 2);
             if (itype == 1) {
                 x->setAxisymmetricFlow();
@@ -454,7 +454,7 @@ extern "C" {
                          size_t nv, const double* v)
     {
         try {
-            auto& sim = SimCabinet::at(i);
+            auto sim = SimCabinet::at(i);
             sim->checkDomainIndex(dom);
             sim->domain(dom).checkComponentIndex(comp);
             vector<double> vv, pv;
@@ -472,7 +472,7 @@ extern "C" {
     int sim1D_setFlatProfile(int i, int dom, int comp, double v)
     {
         try {
-            auto& sim = SimCabinet::at(i);
+            auto sim = SimCabinet::at(i);
             sim->checkDomainIndex(dom);
             sim->domain(dom).checkComponentIndex(comp);
             sim->setFlatProfile(dom, comp, v);
@@ -596,7 +596,7 @@ extern "C" {
     double sim1D_value(int i, int idom, int icomp, int localPoint)
     {
         try {
-            auto& sim = SimCabinet::at(i);
+            auto sim = SimCabinet::at(i);
             sim->checkDomainIndex(idom);
             sim->domain(idom).checkComponentIndex(icomp);
             return sim->value(idom, icomp, localPoint);
@@ -608,7 +608,7 @@ extern "C" {
     double sim1D_workValue(int i, int idom, int icomp, int localPoint)
     {
         try {
-            auto& sim = SimCabinet::at(i);
+            auto sim = SimCabinet::at(i);
             sim->checkDomainIndex(idom);
             sim->domain(idom).checkComponentIndex(icomp);
             return sim->workValue(idom, icomp, localPoint);
@@ -300,9 +300,37 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XY, int loglevel)
 
 int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                            vector<double>& elMolesGoal, int loglevel)
+{
+    // At fixed temperature, the default estimate is inexpensive and is usually
+    // better than the solution at a neighboring state
+    int XY = _equilflag(XYstr);
+    bool tempFixed = (XY == TP || XY == PT || XY == TV || XY == VT);
+    if (options.contin && !tempFixed && m_startX.size() == s.nSpecies()) {
+        try {
+            return solveEquilibrium(s, XYstr, elMolesGoal, loglevel, true);
+        } catch (CanteraError&) {
+            if (loglevel > 0) {
+                writelog("Starting estimate failed; using default estimate.\n");
+            }
+        }
+    }
+    return solveEquilibrium(s, XYstr, elMolesGoal, loglevel, false);
+}
+
+void ChemEquil::setStartingEstimate(const ThermoPhase& s)
+{
+    m_startX.resize(s.nSpecies());
+    s.getMoleFractions(m_startX.data());
+    m_startT = s.temperature();
+}
+
+int ChemEquil::solveEquilibrium(ThermoPhase& s, const char* XYstr,
+                                vector<double>& elMolesGoal, int loglevel,
+                                bool warmStart)
 {
     int fail = 0;
     bool tempFixed = true;
+    bool presFixed = true;
     int XY = _equilflag(XYstr);
     vector<double> state;
     s.saveState(state);
@@ -337,17 +365,20 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
     case SV:
     case VS:
         tempFixed = false;
+        presFixed = false;
         m_p1 = [](ThermoPhase& s) { return s.entropy_mass(); };
         m_p2 = [](ThermoPhase& s) { return s.density(); };
         break;
     case TV:
     case VT:
+        presFixed = false;
         m_p1 = [](ThermoPhase& s) { return s.temperature(); };
         m_p2 = [](ThermoPhase& s) { return s.density(); };
         break;
     case UV:
     case VU:
         tempFixed = false;
+        presFixed = false;
         m_p1 = [](ThermoPhase& s) { return s.intEnergy_mass(); };
         m_p2 = [](ThermoPhase& s) { return s.density(); };
         break;
@@ -355,6 +386,7 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         throw CanteraError("ChemEquil::equilibrate",
                            "illegal property pair '{}'", XYstr);
     }
+    options.propertyPair = XY;
     // If the temperature is one of the specified variables, and
     // it is outside the valid range, throw an exception.
     if (tempFixed) {
@@ -409,8 +441,23 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
 
     double tmaxPhase = s.maxTemp();
     double tminPhase = s.minTemp();
-    // loop to estimate T
-    if (!tempFixed) {
+    if (warmStart) {
+        // Start from the specified estimate, which replaces the estimates of the
+        // temperature and the initial mole numbers below
+        double T = tempFixed ? s.temperature() : m_startT;
+        s.setMoleFractions(m_startX.data());
+        if (presFixed) {
+            s.setState_TP(T, yval);
+        } else {
+            s.setState_TD(T, yval);
+        }
+        for (size_t k = 0; k < m_kk; k++) {
+            xmm[k] = s.moleFraction(k) + 1.0E-32;
+        }
+        s.setMoleFractions(xmm.data());
+        update(s);
+    } else if (!tempFixed) {
+        // loop to estimate T
         double tmin = std::max(s.temperature(), tminPhase);
         if (tmin > tmaxPhase) {
             tmin = tmaxPhase - 20;
@@ -481,7 +528,9 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
         }
     }
 
-    setInitialMoles(s, elMolesGoal,loglevel);
+    if (!warmStart) {
+        setInitialMoles(s, elMolesGoal,loglevel);
+    }
 
     // Calculate initial estimates of the element potentials. This algorithm
     // uses the MultiPhaseEquil object's initialization capabilities to
@@ -574,6 +623,7 @@ int ChemEquil::equilibrate(ThermoPhase& s, const char* XYstr,
                     "Temperature ({} K) outside valid range of {} K "
                     "to {} K", s.temperature(), s.minTemp(), s.maxTemp());
             }
+            setStartingEstimate(s);
             return 0;
         }
         // compute the residual and the Jacobian using the current
@@ -760,6 +810,10 @@ void ChemEquil::equilJacobian(ThermoPhase& s, vector<double>& x,
                               const vector<double>& elmols, DenseMatrix& jac,
                               double xval, double yval, int loglevel)
 {
+    if (options.analyticJacobian && s.type() == "ideal-gas") {
+        equilJacobianIdealGas(s, x, elmols, jac, xval, yval);
+        return;
+    }
     vector<double>& r0 = m_jwork1;
     vector<double>& r1 = m_jwork2;
     size_t len = x.size();
@@ -789,6 +843,142 @@ void ChemEquil::equilJacobian(ThermoPhase& s, vector<double>& x,
     m_doResPerturb = false;
 }
 
+void ChemEquil::equilJacobianIdealGas(ThermoPhase& s, vector<double>& x,
+                                      const vector<double>& elmFracGoal,
+                                      DenseMatrix& jac, double xval, double yval)
+{
+    // For an ideal gas, setToEquilState() sets the partial pressures to
+    // p_k = p0 exp(tmp_k), where tmp_k = sum_m(a_km lambda_m) - g_k(T) and g_k is
+    // the dimensionless reference state Gibbs energy. The derivative of tmp_k with
+    // respect to lambda_m is a_km, and its derivative with respect to log(T) is
+    // the dimensionless reference state enthalpy h_k.
+    setToEquilState(s, x, exp(x[m_mm]));
+    size_t nvar = m_mm + 1;
+    double T = s.temperature();
+    double RT = GasConstant * T;
+    const vector<double>& mw = s.molecularWeights();
+    vector<double> grt(m_kk), hrt(m_kk), cpr(m_kk), sr(m_kk), pp(m_kk), dpp(m_kk);
+    s.getGibbs_RT_ref(grt.data());
+    s.getEnthalpy_RT_ref(hrt.data());
+    s.getCp_R_ref(cpr.data());
+    s.getEntropy_R_ref(sr.data());
+    double p0 = s.refPressure();
+    for (size_t k = 0; k < m_kk; k++) {
+        pp[k] = s.pressure() * m_molefractions[k];
+        // derivative of p_k with respect to tmp_k, matching the limits on tmp_k
+        // applied by IdealGasPhase::setToEquilState
+        double tmp = m_mu_RT[k] - grt[k];
+        if (tmp < -600.) {
+            dpp[k] = 0.0;
+        } else if (tmp > 300.0) {
+            dpp[k] = 2.0 * pp[k] / tmp;
+        } else {
+            dpp[k] = pp[k];
+        }
+    }
+    auto dtmp = [&](size_t k, size_t j) {
+        return (j < m_mm) ? nAtoms(k, j) : hrt[k];
+    };
+
+    // Derivatives of the (unnormalized) element abundances N_m = sum_k(a_km p_k)
+    // and of the mixture properties, with respect to each unknown
+    DenseMatrix dN(m_mm, nvar, 0.0);
+    vector<double> dNtot(nvar, 0.0), dP(nvar, 0.0), dMass(nvar, 0.0);
+    vector<double> dH(nvar, 0.0), dS(nvar, 0.0);
+    double Ntot = 0.0, mass = 0.0, H = 0.0, S = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        double Hk = RT * hrt[k];
+        double Sk = (pp[k] > 0.0) ? GasConstant * (sr[k] - log(pp[k] / p0)) : 0.0;
+        mass += mw[k] * pp[k];
+        H += Hk * pp[k];
+        S += Sk * pp[k];
+        for (size_t m = 0; m < m_mm; m++) {
+            Ntot += nAtoms(k, m) * pp[k];
+        }
+        if (dpp[k] == 0.0) {
+            continue;
+        }
+        for (size_t j = 0; j < nvar; j++) {
+            double dp = dpp[k] * dtmp(k, j);
+            for (size_t m = 0; m < m_mm; m++) {
+                dN(m, j) += nAtoms(k, m) * dp;
+            }
+            dP[j] += dp;
+            dMass[j] += mw[k] * dp;
+            dH[j] += Hk * dp;
+            dS[j] += (Sk - GasConstant) * dp;
+        }
+        dH[m_mm] += pp[k] * RT * cpr[k];
+        dS[m_mm] += pp[k] * GasConstant * cpr[k];
+    }
+    for (size_t j = 0; j < nvar; j++) {
+        for (size_t m = 0; m < m_mm; m++) {
+            dNtot[j] += dN(m, j);
+        }
+    }
+
+    // Rows for the element abundance equations
+    vector<double>& elmFrac = m_elementmolefracs;
+    for (size_t n = 0; n < m_mm; n++) {
+        size_t m = m_orderVectorElements[n];
+        for (size_t j = 0; j < nvar; j++) {
+            jac(m, j) = 0.0;
+        }
+        if ((elmFracGoal[m] < m_elemFracCutoff && m != m_eloc) || n >= m_nComponents) {
+            jac(m, m) = 1.0;
+            continue;
+        }
+        double scale = -1.0 / Ntot;
+        if (!(elmFracGoal[m] < 1.0E-10 || elmFrac[m] < 1.0E-10 || m == m_eloc)) {
+            scale /= 1.0 + elmFrac[m];
+        }
+        for (size_t j = 0; j < nvar; j++) {
+            jac(m, j) = scale * (dN(m, j) - elmFrac[m] * dNtot[j]);
+        }
+    }
+
+    // Rows for the specified properties. Mass-specific properties are ratios of
+    // sums over species weighted by the partial pressures to the sum of p_k M_k.
+    auto setPropertyRow = [&](size_t row, char property, double value) {
+        for (size_t j = 0; j < nvar; j++) {
+            double d = 0.0;
+            switch (property) {
+            case 'T':
+                d = (j == m_mm) ? T : 0.0;
+                break;
+            case 'P':
+                d = dP[j];
+                break;
+            case 'V': // density
+                d = dMass[j] / RT - ((j == m_mm) ? mass / RT : 0.0);
+                break;
+            case 'H':
+                d = (dH[j] - H / mass * dMass[j]) / mass;
+                break;
+            case 'U': // U_k = H_k - RT
+                d = (dH[j] - RT * dP[j] - ((j == m_mm) ? RT * s.pressure() : 0.0)
+                     - (H - RT * s.pressure()) / mass * dMass[j]) / mass;
+                break;
+            case 'S':
+                d = (dS[j] - S / mass * dMass[j]) / mass;
+                break;
+            }
+            jac(row, j) = d / value;
+        }
+    };
+    string pair;
+    switch (options.propertyPair) {
+    case TP: case PT: pair = "TP"; break;
+    case HP: case PH: pair = "HP"; break;
+    case SP: case PS: pair = "SP"; break;
+    case SV: case VS: pair = "SV"; break;
+    case TV: case VT: pair = "TV"; break;
+    case UV: case VU: pair = "UV"; break;
+    }
+    setPropertyRow(m_mm, pair[0], xval);
+    setPropertyRow(m_skip, pair[1], yval);
+}
+
 double ChemEquil::calcEmoles(ThermoPhase& s, vector<double>& x, const double& n_t,
                              const vector<double>& Xmol_i_calc,
                              vector<double>& eMolesCalc, vector<double>& n_i_calc,
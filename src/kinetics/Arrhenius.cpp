@@ -153,4 +153,11 @@ bool ArrheniusData::update(const ThermoPhase& phase, const Kinetics& kin)
     return true;
 }
 
+void ArrheniusData::update(const ReactionState& state)
+{
+    if (state.temperature != temperature) {
+        update(state.temperature);
+    }
+}
+
 }
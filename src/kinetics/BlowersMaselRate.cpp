@@ -36,6 +36,17 @@ bool BlowersMaselData::update(const ThermoPhase& phase, const Kinetics& kin)
     return changed;
 }
 
+void BlowersMaselData::update(const ReactionState& state)
+{
+    if (state.temperature != temperature) {
+        ReactionData::update(state.temperature);
+    }
+    density = state.density;
+    std::copy(state.partialMolarEnthalpies,
+              state.partialMolarEnthalpies + partialMolarEnthalpies.size(),
+              partialMolarEnthalpies.begin());
+}
+
 BlowersMaselRate::BlowersMaselRate()
 {
     m_Ea_str = "Ea0";
@@ -3,6 +3,7 @@
 
 #include "cantera/kinetics/BulkKinetics.h"
 #include "cantera/kinetics/Reaction.h"
+#include "cantera/kinetics/ReactionData.h"
 #include "cantera/thermo/ThermoPhase.h"
 
 namespace Cantera
@@ -534,6 +535,120 @@ void BulkKinetics::updateROP()
     m_ROP_ok = true;
 }
 
+void BulkKinetics::getNetProductionRatesBatch(size_t n, const double* T,
+                                              const double* P, const double* Y,
+                                              double* wdot)
+{
+    if (thermo().type() != "ideal-gas") {
+        throw NotImplementedError("BulkKinetics::getNetProductionRatesBatch",
+            "Only implemented for ideal gas phases.");
+    }
+    const MultiSpeciesThermo& spthermo = thermo().speciesThermo();
+    const vector<double>& rmolwts = thermo().inverseMolecularWeights();
+    double Pref = thermo().refPressure();
+    size_t nRxn = nReactions();
+
+    // Work arrays holding intermediate results for a block of states, where
+    // entries for each state are contiguous
+    const size_t blockSize = 64;
+    size_t nb = std::min(n, blockSize);
+    vector<double> conc(nb * m_kk), hbar(nb * m_kk);
+    vector<double> concm(nb * nRxn, 0.0), rkcn(nb * nRxn), kf(nb * nRxn, 0.0);
+    vector<ReactionState> states(nb);
+
+    // Work arrays used for a single state
+    vector<double> ym(m_kk), cp_R(m_kk), s_R(m_kk), mu0(m_kk), work;
+    vector<double> ropf(nRxn), ropr(nRxn);
+
+    for (size_t start = 0; start < n; start += nb) {
+        size_t m = std::min(nb, n - start);
+        for (size_t j = 0; j < m; j++) {
+            size_t i = start + j;
+            double* c = conc.data() + j * m_kk;
+            double* h = hbar.data() + j * m_kk;
+            double* rkc = rkcn.data() + j * nRxn;
+
+            // Concentrations, following IdealGasPhase::setState_TPY
+            const double* y = Y + i * m_kk;
+            double ysum = 0.0;
+            for (size_t k = 0; k < m_kk; k++) {
+                ysum += std::max(y[k], 0.0);
+            }
+            double rysum = 1.0 / ysum;
+            double ymsum = 0.0;
+            for (size_t k = 0; k < m_kk; k++) {
+                ym[k] = std::max(y[k], 0.0) * rysum * rmolwts[k];
+                ymsum += ym[k];
+            }
+            double mmw = 1.0 / ymsum;
+            double RT = GasConstant * T[i];
+            double rho = P[i] * mmw / RT;
+            for (size_t k = 0; k < m_kk; k++) {
+                c[k] = ym[k] * rho;
+            }
+            double ctot = rho / mmw;
+            m_multi_concm.update(c, ctot, concm.data() + j * nRxn);
+
+            // Standard chemical potentials and partial molar enthalpies
+            spthermo.update(T[i], cp_R.data(), h, s_R.data(), work);
+            double tmp = log(P[i] / Pref) * RT;
+            for (size_t k = 0; k < m_kk; k++) {
+                mu0[k] = (h[k] - s_R[k]) * RT + tmp;
+                h[k] *= RT;
+            }
+
+            // Reciprocals of equilibrium constants
+            getRevReactionDelta(mu0.data(), rkc);
+            double logStandConc = log(P[i] / RT);
+            double rrt = 1.0 / RT;
+            for (size_t irxn : m_revindex) {
+                rkc[irxn] = std::min(
+                    exp(rkc[irxn] * rrt - m_dn[irxn] * logStandConc), BigNumber);
+            }
+            for (size_t irxn : m_irrev) {
+                rkc[irxn] = 0.0;
+            }
+
+            ReactionState& state = states[j];
+            state.temperature = T[i];
+            state.pressure = P[i];
+            state.density = rho;
+            state.molarDensity = ctot;
+            state.thirdBodyConcentrations = concm.data() + j * nRxn;
+            state.partialMolarEnthalpies = h;
+        }
+
+        for (auto& rates : m_rateHandlers) {
+            rates->getRateConstantsBatch(m, states.data(), kf.data(), nRxn);
+        }
+
+        for (size_t j = 0; j < m; j++) {
+            const double* c = conc.data() + j * m_kk;
+            const double* kf_j = kf.data() + j * nRxn;
+            const double* rkc = rkcn.data() + j * nRxn;
+            for (size_t r = 0; r < nRxn; r++) {
+                ropf[r] = kf_j[r] * m_perturb[r];
+            }
+            if (!m_concm.empty()) {
+                m_multi_concm.multiply(ropf.data(), concm.data() + j * nRxn);
+            }
+            for (size_t r = 0; r < nRxn; r++) {
+                ropr[r] = ropf[r] * rkc[r];
+            }
+            m_reactantStoich.multiply(c, ropf.data());
+            m_revProductStoich.multiply(c, ropr.data());
+            for (size_t r = 0; r < nRxn; r++) {
+                ropf[r] -= ropr[r];
+            }
+
+            double* w = wdot + (start + j) * m_kk;
+            std::fill(w, w + m_kk, 0.0);
+            m_productStoich.incrementSpecies(ropf.data(), w);
+            m_reactantStoich.decrementSpecies(ropf.data(), w);
+        }
+    }
+}
+
 void BulkKinetics::getThirdBodyConcentrations(double* concm)
 {
     updateROP();
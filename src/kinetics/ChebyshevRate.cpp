@@ -47,6 +47,121 @@ void ChebyshevData::restore()
     m_pressure_buf = -1.;
 }
 
+void PackedChebyshevParameters::resize(size_t n)
+{
+    TrNum.resize(n, NAN);
+    TrDen.resize(n, NAN);
+    PrNum.resize(n, NAN);
+    PrDen.resize(n, NAN);
+    kf.resize(n, NAN);
+    reshape(n, nT, nP);
+}
+
+void PackedChebyshevParameters::set(size_t i, double TrNum_, double TrDen_,
+                                    double PrNum_, double PrDen_, const Array2D& c)
+{
+    if (c.nRows() > nT || c.nColumns() > nP) {
+        reshape(kf.size(), std::max(c.nRows(), nT), std::max(c.nColumns(), nP));
+    }
+    size_t n = kf.size();
+    TrNum[i] = TrNum_;
+    TrDen[i] = TrDen_;
+    PrNum[i] = PrNum_;
+    PrDen[i] = PrDen_;
+    for (size_t t = 0; t < nT; t++) {
+        for (size_t p = 0; p < nP; p++) {
+            coeffs[(t * nP + p) * n + i] =
+                (t < c.nRows() && p < c.nColumns()) ? c(t, p) : 0.0;
+        }
+    }
+    log10P = NAN;
+}
+
+void PackedChebyshevParameters::reshape(size_t n, size_t nT_, size_t nP_)
+{
+    size_t nOld = coeffs.size() / (nT * nP);
+    vector<double> c(nT_ * nP_ * n, 0.0);
+    for (size_t t = 0; t < nT; t++) {
+        for (size_t p = 0; p < nP; p++) {
+            for (size_t i = 0; i < std::min(n, nOld); i++) {
+                c[(t * nP_ + p) * n + i] = coeffs[(t * nP + p) * nOld + i];
+            }
+        }
+    }
+    coeffs = std::move(c);
+    nT = nT_;
+    nP = nP_;
+    dotProd.assign(nT * n, NAN);
+    m_x.resize(n);
+    m_cn.resize(n);
+    m_cnm1.resize(n);
+    log10P = NAN;
+}
+
+void PackedChebyshevParameters::updatePressure(double log10P_)
+{
+    size_t n = kf.size();
+    log10P = log10P_;
+    double* Pr = m_x.data();
+    double* Cn = m_cn.data();
+    double* Cnm1 = m_cnm1.data();
+    double* dot = dotProd.data();
+    const double* c = coeffs.data();
+    for (size_t i = 0; i < n; i++) {
+        Pr[i] = (2 * log10P + PrNum[i]) * PrDen[i];
+        Cnm1[i] = Pr[i];
+        Cn[i] = 1;
+    }
+    for (size_t t = 0; t < nT; t++) {
+        for (size_t i = 0; i < n; i++) {
+            dot[t * n + i] = c[t * nP * n + i];
+        }
+    }
+    for (size_t p = 1; p < nP; p++) {
+        for (size_t i = 0; i < n; i++) {
+            double Cnp1 = 2 * Pr[i] * Cn[i] - Cnm1[i];
+            Cnm1[i] = Cn[i];
+            Cn[i] = Cnp1;
+        }
+        for (size_t t = 0; t < nT; t++) {
+            const double* ctp = c + (t * nP + p) * n;
+            double* dot_t = dot + t * n;
+            for (size_t i = 0; i < n; i++) {
+                dot_t[i] += Cn[i] * ctp[i];
+            }
+        }
+    }
+}
+
+void PackedChebyshevParameters::eval(double recipT)
+{
+    size_t n = kf.size();
+    double* Tr = m_x.data();
+    double* Cn = m_cn.data();
+    double* Cnm1 = m_cnm1.data();
+    double* logk = kf.data();
+    const double* dot = dotProd.data();
+    for (size_t i = 0; i < n; i++) {
+        Tr[i] = (2 * recipT + TrNum[i]) * TrDen[i];
+        Cnm1[i] = Tr[i];
+        Cn[i] = 1;
+        logk[i] = dot[i];
+    }
+    for (size_t t = 1; t < nT; t++) {
+        const double* dot_t = dot + t * n;
+        for (size_t i = 0; i < n; i++) {
+            double Cnp1 = 2 * Tr[i] * Cn[i] - Cnm1[i];
+            logk[i] += Cnp1 * dot_t[i];
+            Cnm1[i] = Cn[i];
+            Cn[i] = Cnp1;
+        }
+    }
+    double ln10 = std::log(10.0);
+    for (size_t i = 0; i < n; i++) {
+        kf[i] = std::exp(ln10 * logk[i]);
+    }
+}
+
 ChebyshevRate::ChebyshevRate(double Tmin, double Tmax, double Pmin, double Pmax,
                              const Array2D& coeffs) : ChebyshevRate()
 {
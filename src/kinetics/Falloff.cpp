@@ -54,6 +54,16 @@ bool FalloffData::update(const ThermoPhase& phase, const Kinetics& kin)
     return changed;
 }
 
+void FalloffData::update(const ReactionState& state)
+{
+    if (state.temperature != temperature) {
+        ReactionData::update(state.temperature);
+    }
+    molar_density = state.molarDensity;
+    std::copy(state.thirdBodyConcentrations,
+              state.thirdBodyConcentrations + conc_3b.size(), conc_3b.begin());
+}
+
 void FalloffData::perturbThirdBodies(double deltaM)
 {
     if (m_perturbed) {
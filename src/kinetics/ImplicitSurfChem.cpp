@@ -173,6 +173,14 @@ void ImplicitSurfChem::eval(double time, double* y, double* ydot, double* p)
     }
 }
 
+void ImplicitSurfChem::setAnalyticJacobian(bool analytic)
+{
+    m_analyticJacobian = analytic;
+    if (m_surfSolver) {
+        m_surfSolver->setAnalyticJacobian(analytic);
+    }
+}
+
 void ImplicitSurfChem::solvePseudoSteadyStateProblem(int ifuncOverride,
         double timeScaleOverride)
 {
@@ -183,6 +191,7 @@ void ImplicitSurfChem::solvePseudoSteadyStateProblem(int ifuncOverride,
     double time_scale = timeScaleOverride;
     if (!m_surfSolver) {
         m_surfSolver = make_unique<solveSP>(this, bulkFunc);
+        m_surfSolver->setAnalyticJacobian(m_analyticJacobian);
         // set ifunc, which sets the algorithm.
         ifunc = SFLUX_INITIALIZE;
     } else {
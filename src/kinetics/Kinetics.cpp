@@ -413,6 +413,14 @@ void Kinetics::getNetProductionRates(double* net)
     m_reactantStoich.decrementSpecies(m_ropnet.data(), net);
 }
 
+void Kinetics::getNetProductionRatesBatch(size_t n, const double* T,
+                                          const double* P, const double* Y,
+                                          double* wdot)
+{
+    throw NotImplementedError("Kinetics::getNetProductionRatesBatch",
+        "Not implemented for kinetics type '{}'.", kineticsType());
+}
+
 void Kinetics::getCreationRates_ddT(double* dwdot)
 {
     Eigen::Map<Eigen::VectorXd> out(dwdot, m_kk);
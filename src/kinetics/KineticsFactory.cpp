@@ -217,4 +217,26 @@ void addReactions(Kinetics& kin, const AnyMap& phaseNode, const AnyMap& rootNode
     kin.resizeReactions();
 }
 
+void addReactions(Kinetics& kin, Kinetics& other)
+{
+    kin.skipUndeclaredSpecies(other.skipUndeclaredSpecies());
+    kin.skipUndeclaredThirdBodies(other.skipUndeclaredThirdBodies());
+    kin.setExplicitThirdBodyDuplicateHandling(
+        other.explicitThirdBodyDuplicateHandling());
+    for (size_t i = 0; i < other.nReactions(); i++) {
+        kin.addReaction(other.reaction(i), false);
+    }
+    kin.resizeReactions();
+    for (size_t i = 0; i < other.nReactions(); i++) {
+        kin.setMultiplier(i, other.multiplier(i));
+    }
+    try {
+        AnyMap settings;
+        other.getDerivativeSettings(settings);
+        kin.setDerivativeSettings(settings);
+    } catch (NotImplementedError&) {
+        // Derivative settings are not defined for this kinetics model
+    }
+}
+
 }
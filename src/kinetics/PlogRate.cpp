@@ -47,6 +47,134 @@ void PlogData::restore()
     m_pressure_buf = -1.;
 }
 
+void PackedPlogParameters::resize(size_t n)
+{
+    m_tables.resize(n);
+    kf.resize(n, NAN);
+    m_grouped = false;
+    logP = NAN;
+}
+
+void PackedPlogParameters::set(size_t i,
+                               const map<double, pair<size_t, size_t>>& pressures,
+                               const vector<ArrheniusRate>& rates)
+{
+    Table& table = m_tables[i];
+    table.logP.clear();
+    table.offsets.assign(1, 0);
+    size_t nTerms = 0;
+    for (const auto& [logp, range] : pressures) {
+        nTerms += std::max<size_t>(range.second - range.first, 1);
+    }
+    table.terms.resize(0);
+    table.terms.resize(nTerms);
+    size_t j = 0;
+    for (const auto& [logp, range] : pressures) {
+        table.logP.push_back(logp);
+        if (range.first == range.second) {
+            // empty rate object: ensure that the rate evaluates to NaN
+            table.terms.A[j++] = NAN;
+        }
+        for (size_t k = range.first; k < range.second; k++) {
+            rates[k].packParameters(table.terms, j++);
+        }
+        table.offsets.push_back(j);
+    }
+    m_grouped = false;
+    logP = NAN;
+}
+
+void PackedPlogParameters::groupGrids()
+{
+    map<vector<double>, size_t> gridIndex;
+    m_grids.clear();
+    for (auto& table : m_tables) {
+        auto [iter, added] = gridIndex.emplace(table.logP, m_grids.size());
+        if (added) {
+            m_grids.push_back(table.logP);
+        }
+        table.grid = iter->second;
+    }
+    m_intervals.assign(m_grids.size(), npos);
+    m_activeOffsets.assign(2 * m_tables.size() + 1, 0);
+    m_logP1.resize(m_tables.size());
+    m_rDeltaP.resize(m_tables.size());
+    m_grouped = true;
+}
+
+void PackedPlogParameters::updatePressure(double logP_)
+{
+    bool changed = !m_grouped;
+    if (!m_grouped) {
+        groupGrids();
+    }
+    logP = logP_;
+    for (size_t g = 0; g < m_grids.size(); g++) {
+        const auto& grid = m_grids[g];
+        auto iter = std::upper_bound(grid.begin(), grid.end(), logP);
+        AssertThrowMsg(iter != grid.end(), "PackedPlogParameters::updatePressure",
+                       "Pressure out of range: {}", logP);
+        AssertThrowMsg(iter != grid.begin(), "PackedPlogParameters::updatePressure",
+                       "Pressure out of range: {}", logP);
+        size_t k = iter - grid.begin();
+        if (k != m_intervals[g]) {
+            m_intervals[g] = k;
+            changed = true;
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+    // Gather Arrhenius expressions at the lower and upper pressures
+    size_t nActive = 0;
+    for (const auto& table : m_tables) {
+        size_t k = m_intervals[table.grid];
+        nActive += table.offsets[k + 1] - table.offsets[k - 1];
+    }
+    m_active.resize(0);
+    m_active.resize(nActive);
+    size_t j = 0;
+    for (size_t i = 0; i < m_tables.size(); i++) {
+        const Table& table = m_tables[i];
+        size_t k = m_intervals[table.grid];
+        for (size_t level = k - 1; level <= k; level++) {
+            m_activeOffsets[2 * i + level - k + 1] = j;
+            for (size_t n = table.offsets[level]; n < table.offsets[level + 1]; n++) {
+                m_active.A[j] = table.terms.A[n];
+                m_active.b[j] = table.terms.b[n];
+                m_active.Ea_R[j] = table.terms.Ea_R[n];
+                m_active.E4_R[j] = table.terms.E4_R[n];
+                j++;
+            }
+        }
+        m_logP1[i] = table.logP[k - 1];
+        m_rDeltaP[i] = 1.0 / (table.logP[k] - table.logP[k - 1]);
+    }
+    m_activeOffsets.back() = j;
+}
+
+void PackedPlogParameters::eval(double logT, double recipT)
+{
+    m_active.eval(logT, recipT, 0.);
+    const double* k = m_active.kf.data();
+    const size_t* offsets = m_activeOffsets.data();
+    for (size_t i = 0; i < kf.size(); i++) {
+        double k1 = 1e-300; // non-zero to make log(k) finite
+        for (size_t j = offsets[2 * i]; j < offsets[2 * i + 1]; j++) {
+            k1 += k[j];
+        }
+        double k2 = 1e-300;
+        for (size_t j = offsets[2 * i + 1]; j < offsets[2 * i + 2]; j++) {
+            k2 += k[j];
+        }
+        double log_k1 = std::log(k1);
+        double log_k2 = std::log(k2);
+        kf[i] = std::exp(
+            log_k1 + (log_k2 - log_k1) * (logP - m_logP1[i]) * m_rDeltaP[i]);
+    }
+}
+
 // Methods of class PlogRate
 
 PlogRate::PlogRate(const std::multimap<double, ArrheniusRate>& rates)
@@ -14,7 +14,8 @@ namespace Cantera
 
 // STATIC ROUTINES DEFINED IN THIS FILE
 
-static double calc_damping(double* x, double* dx, size_t dim, int*);
+static double calc_damping(double* x, double* dx, size_t dim, int*,
+                           double& damp_old);
 static double calcWeightedNorm(const double [], const double dx[], size_t);
 
 // solveSP Class Definitions
@@ -75,6 +76,24 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
         }
     }
 
+    m_solnIndexKinSpecies.resize(m_numSurfPhases);
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        InterfaceKinetics* kin = m_objects[m_indexKinObjSurfPhase[isp]];
+        m_solnIndexKinSpecies[isp].assign(kin->nTotalSpecies(), npos);
+        for (size_t iph = 0; iph < kin->nPhases(); iph++) {
+            for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
+                if (&kin->thermo(iph) != m_ptrsSurfPhase[jsp]) {
+                    continue;
+                }
+                size_t kstart = kin->kineticsSpeciesIndex(0, iph);
+                for (size_t k = 0; k < m_nSpeciesSurfPhase[jsp]; k++) {
+                    m_solnIndexKinSpecies[isp][kstart + k] =
+                        m_eqnIndexStartSolnPhase[jsp] + k;
+                }
+            }
+        }
+    }
+
     // Dimension solution vector
     size_t dim1 = std::max<size_t>(1, m_neq);
     m_CSolnSP.resize(dim1, 0.0);
@@ -201,7 +220,8 @@ int solveSP::solveSurfProb(int ifunc, double time_scale, double TKelvin,
 
         // Calculate the Damping factor needed to keep all unknowns between 0
         // and 1, and not allow too large a change (factor of 2) in any unknown.
-        damp = calc_damping(m_CSolnSP.data(), m_resid.data(), m_neq, &label_d);
+        damp = calc_damping(m_CSolnSP.data(), m_resid.data(), m_neq, &label_d,
+                            m_dampOld);
 
         // Calculate the weighted norm of the update vector Here, resid is the
         // delta of the solution, in concentration units.
@@ -422,6 +442,13 @@ void solveSP::resjac_eval(DenseMatrix& jac, double resid[], double CSoln[],
     size_t kColIndex = 0;
     // Calculate the residual
     fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
+    if (m_analyticJacobian && m_bulkFunc != BULK_DEPOSITION
+        && analyticJacobian(jac, do_time, deltaT))
+    {
+        m_nJacAnalytic++;
+        return;
+    }
+    m_nJacFiniteDiff++;
     // Now we will look over the columns perturbing each unknown.
     for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
         size_t nsp = m_nSpeciesSurfPhase[jsp];
@@ -458,22 +485,73 @@ void solveSP::resjac_eval(DenseMatrix& jac, double resid[], double CSoln[],
     }
 }
 
+bool solveSP::analyticJacobian(DenseMatrix& jac, const bool do_time,
+                               const double deltaT)
+{
+    // The activity concentrations of the surface species are equal to the
+    // unknowns, so the derivatives with respect to the activity concentrations are
+    // the derivatives with respect to the unknowns
+    jac.zero();
+    for (size_t isp = 0; isp < m_numSurfPhases; isp++) {
+        InterfaceKinetics* kin = m_objects[m_indexKinObjSurfPhase[isp]];
+        Eigen::SparseMatrix<double> dwdot;
+        try {
+            dwdot = kin->netProductionRates_ddCi();
+        } catch (NotImplementedError&) {
+            // Don't try again for subsequent iterations
+            m_analyticJacobian = false;
+            return false;
+        }
+        size_t kstart = kin->kineticsSpeciesIndex(0, 0);
+        size_t ieqStart = m_eqnIndexStartSolnPhase[isp];
+        size_t nsp = m_nSpeciesSurfPhase[isp];
+        const auto& solnIndex = m_solnIndexKinSpecies[isp];
+        for (int col = 0; col < dwdot.outerSize(); col++) {
+            size_t jeq = solnIndex[col];
+            if (jeq == npos) {
+                continue;
+            }
+            for (Eigen::SparseMatrix<double>::InnerIterator it(dwdot, col); it; ++it) {
+                size_t k = static_cast<size_t>(it.row());
+                if (k >= kstart && k < kstart + nsp) {
+                    jac(ieqStart + k - kstart, jeq) -= it.value();
+                }
+            }
+        }
+        if (do_time) {
+            for (size_t k = 0; k < nsp; k++) {
+                jac(ieqStart + k, ieqStart + k) += 1.0 / deltaT;
+            }
+        }
+        // The equation for the largest species is replaced by the site balance
+        size_t kspecial = ieqStart + m_spSurfLarge[isp];
+        for (size_t j = 0; j < m_neq; j++) {
+            jac(kspecial, j) = 0.0;
+        }
+        for (size_t k = 0; k < nsp; k++) {
+            jac(kspecial, ieqStart + k) = -1.0;
+        }
+    }
+    return true;
+}
+
 /**
  * This function calculates a damping factor for the Newton iteration update
  * vector, dxneg, to insure that all site and bulk fractions, x, remain
  * bounded between zero and one.
  *
  *      dxneg[] = negative of the update vector.
+ *      damp_old = damping factor of the previous step; updated on return.
  *
  * The constant "APPROACH" sets the fraction of the distance to the boundary
  * that the step can take.  If the full step would not force any fraction
  * outside of 0-1, then Newton's method is allowed to operate normally.
  */
-static double calc_damping(double x[], double dxneg[], size_t dim, int* label)
+static double calc_damping(double x[], double dxneg[], size_t dim, int* label,
+                           double& damp_old)
 {
     const double APPROACH = 0.80;
     double damp = 1.0;
-    static double damp_old = 1.0; //! @todo this variable breaks thread safety
     *label = -1;
 
     for (size_t i = 0; i < dim; i++) {
@@ -33,10 +33,83 @@ void AdaptivePreconditioner::initialize(size_t networkSize)
     if (m_drop_tol == 0) {
         setIlutFillFactor(static_cast<int>(m_dim) / 2);
     }
+    m_patternValid = false;
+    m_refactorOnly = false;
+    m_nAnalyses = 0;
     // update initialized status
     m_init = true;
 }
 
+void AdaptivePreconditioner::reset()
+{
+    if (m_reusePattern) {
+        // keep the existing matrix so its structure can be reused
+        m_jac_trips.clear();
+    } else {
+        EigenSparseJacobian::reset();
+    }
+}
+
+void AdaptivePreconditioner::updatePreconditioner()
+{
+    bool samePattern = m_reusePattern && m_patternValid
+                       && m_jac_trips.size() == m_pattern.size();
+    for (size_t k = 0; samePattern && k < m_jac_trips.size(); k++) {
+        samePattern = (m_jac_trips[k].row() == m_pattern[k].first
+                       && m_jac_trips[k].col() == m_pattern[k].second);
+    }
+
+    if (samePattern) {
+        // Update values in place, using the same sequence of operations as
+        // setFromTriplets and the subsequent evaluation of P = (I - gamma * J_bar)
+        double* values = m_matrix.valuePtr();
+        std::fill(values, values + m_matrix.nonZeros(), 0.0);
+        for (size_t k = 0; k < m_jac_trips.size(); k++) {
+            values[m_valueIndex[k]] += m_jac_trips[k].value();
+        }
+        for (Eigen::Index k = 0; k < m_matrix.nonZeros(); k++) {
+            values[k] = 0.0 - m_gamma * values[k];
+        }
+        for (auto k : m_diagIndex) {
+            values[k] += 1.0;
+        }
+        m_refactorOnly = true;
+        factorize();
+        return;
+    }
+
+    m_matrix.setFromTriplets(m_jac_trips.begin(), m_jac_trips.end());
+    m_matrix = m_identity - m_gamma * m_matrix;
+    m_matrix.makeCompressed();
+    m_patternValid = m_reusePattern;
+    if (m_reusePattern) {
+        // store the position of each Jacobian element within the matrix
+        const auto* outer = m_matrix.outerIndexPtr();
+        const auto* inner = m_matrix.innerIndexPtr();
+        m_pattern.resize(m_jac_trips.size());
+        m_valueIndex.resize(m_jac_trips.size());
+        for (size_t k = 0; k < m_jac_trips.size(); k++) {
+            int row = m_jac_trips[k].row();
+            int col = m_jac_trips[k].col();
+            m_pattern[k] = {row, col};
+            m_valueIndex[k] = std::lower_bound(inner + outer[col],
+                                               inner + outer[col + 1], row) - inner;
+        }
+        m_diagIndex.resize(m_dim);
+        for (size_t j = 0; j < m_dim; j++) {
+            m_diagIndex[j] = std::lower_bound(inner + outer[j], inner + outer[j + 1],
+                                              static_cast<int>(j)) - inner;
+        }
+    }
+    factorize();
+}
+
+void AdaptivePreconditioner::updateTransient(double rdt, int* mask)
+{
+    m_patternValid = false;
+    EigenSparseJacobian::updateTransient(rdt, mask);
+}
+
 void AdaptivePreconditioner::setup()
 {
     warn_deprecated("AdaptivePreconditioner::setup",
@@ -52,8 +125,13 @@ void AdaptivePreconditioner::factorize()
     }
     // compress sparse matrix structure
     m_matrix.makeCompressed();
-    // analyze and factorize
-    m_solver.compute(m_matrix);
+    // analyze (unless the pattern is unchanged) and factorize
+    if (!m_refactorOnly) {
+        m_solver.analyzePattern(m_matrix);
+        m_nAnalyses++;
+    }
+    m_refactorOnly = false;
+    m_solver.factorize(m_matrix);
     // check for errors
     if (m_solver.info() != Eigen::Success) {
         throw CanteraError("AdaptivePreconditioner::factorize",
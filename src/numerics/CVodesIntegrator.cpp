@@ -74,8 +74,10 @@ extern "C" {
     {
         FuncEval* f = (FuncEval*) f_data;
         if (!jok) {
-            *jcurPtr = true; // jacobian data was recomputed
-            return f->preconditioner_setup_nothrow(t, NV_DATA_S(y), gamma);
+            int flag = f->preconditioner_setup_nothrow(t, NV_DATA_S(y), gamma);
+            // jacobian data was recomputed, unless previous data was reused
+            *jcurPtr = f->preconditionerJacobianCurrent();
+            return flag;
         } else {
             f->updatePreconditioner(gamma); // updates preconditioner with new gamma
             *jcurPtr = false; // indicates that Jacobian data was not recomputed
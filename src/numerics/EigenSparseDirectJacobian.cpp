@@ -9,15 +9,34 @@
 namespace Cantera
 {
 
+void EigenSparseDirectJacobian::initialize(size_t networkSize)
+{
+    EigenSparseJacobian::initialize(networkSize);
+    m_pattern.resize(0, 0);
+    m_nAnalyses = 0;
+}
+
 void EigenSparseDirectJacobian::factorize()
 {
+    // Merge the current sparsity pattern with the previously analyzed one, and only
+    // repeat the symbolic analysis if this adds new elements
+    bool analyze = true;
+    if (m_pattern.rows() == m_matrix.rows()) {
+        m_matrix = m_matrix + m_pattern;
+        analyze = (m_matrix.nonZeros() != m_pattern.nonZeros());
+    }
     m_matrix.makeCompressed();
-    // analyze and factorize
-    m_solver.compute(m_matrix);
+    if (analyze) {
+        m_solver.analyzePattern(m_matrix);
+        m_pattern = 0.0 * m_matrix;
+        m_nAnalyses++;
+    }
+    m_solver.factorize(m_matrix);
     // check for errors
     if (m_solver.info() != Eigen::Success) {
         throw CanteraError("EigenSparseDirectJacobian::factorize",
-                           "error code: {}", static_cast<int>(m_solver.info()));
+                           "error code: {}: {}", static_cast<int>(m_solver.info()),
+                           m_solver.lastErrorMessage());
     }
 }
 
@@ -31,4 +50,9 @@ void EigenSparseDirectJacobian::solve(const size_t stateSize, double* b, double*
     }
 }
 
+int EigenSparseDirectJacobian::info() const
+{
+    return (m_solver.info() == Eigen::Success) ? 0 : -1;
+}
+
 }
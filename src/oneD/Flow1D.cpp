@@ -4,9 +4,11 @@
 // at https://cantera.org/license.txt for license and copyright information.
 
 #include "cantera/base/SolutionArray.h"
+#include "cantera/base/ThreadPool.h"
 #include "cantera/oneD/Flow1D.h"
 #include "cantera/oneD/refine.h"
 #include "cantera/transport/Transport.h"
+#include "cantera/transport/MultiTransport.h"
 #include "cantera/transport/TransportFactory.h"
 #include "cantera/numerics/funcs.h"
 #include "cantera/base/global.h"
@@ -134,6 +136,7 @@ void Flow1D::setKinetics(shared_ptr<Kinetics> kin)
 {
     m_kin = kin.get();
     m_solution->setKinetics(kin);
+    updateThreadSolutions();
 }
 
 void Flow1D::setTransport(shared_ptr<Transport> trans)
@@ -145,15 +148,24 @@ void Flow1D::setTransport(shared_ptr<Transport> trans)
     if (m_trans->transportModel() == "none") {
         throw CanteraError("Flow1D::setTransport", "Invalid Transport model 'none'.");
     }
-    m_do_multicomponent = (m_trans->transportModel() == "multicomponent" ||
-        m_trans->transportModel() == "multicomponent-CK");
+    string model = m_trans->transportModel();
+    m_do_multicomponent = (model == "multicomponent" || model == "multicomponent-CK"
+        || model == "multicomponent-iterative" || model == "multicomponent-iterative-CK");
+    m_iterativeMultiDiff = (model == "multicomponent-iterative"
+                            || model == "multicomponent-iterative-CK");
 
     m_diff.resize(m_nsp * m_points);
     if (m_do_multicomponent) {
         m_multidiff.resize(m_nsp * m_nsp*m_points);
         m_dthermal.resize(m_nsp, m_points, 0.0);
     }
+    if (m_iterativeMultiDiff) {
+        m_multiWeights.resize(m_nsp, m_points, 0.0);
+        m_diffVelocity.resize(m_nsp, m_points, 0.0);
+        m_diffDeltaX.resize(m_nsp, m_points, 0.0);
+    }
     m_solution->setTransport(trans);
+    updateThreadSolutions();
 }
 
 void Flow1D::resize(size_t ncomponents, size_t points)
@@ -170,6 +182,11 @@ void Flow1D::resize(size_t ncomponents, size_t points)
         m_multidiff.resize(m_nsp*m_nsp*m_points);
         m_dthermal.resize(m_nsp, m_points, 0.0);
     }
+    if (m_iterativeMultiDiff) {
+        m_multiWeights.resize(m_nsp, m_points, 0.0);
+        m_diffVelocity.resize(m_nsp, m_points, 0.0);
+        m_diffDeltaX.resize(m_nsp, m_points, 0.0);
+    }
     m_flux.resize(m_nsp,m_points);
     m_wdot.resize(m_nsp,m_points, 0.0);
     m_hk.resize(m_nsp, m_points, 0.0);
@@ -242,22 +259,118 @@ void Flow1D::_getInitialSoln(double* x)
 
 void Flow1D::setGas(const double* x, size_t j)
 {
-    m_thermo->setTemperature(T(x,j));
-    const double* yy = x + m_nv*j + c_offset_Y;
-    m_thermo->setMassFractions_NoNorm(yy);
-    m_thermo->setPressure(m_press);
+    setGasState(*m_thermo, x, j);
 }
 
 void Flow1D::setGasAtMidpoint(const double* x, size_t j)
 {
-    m_thermo->setTemperature(0.5*(T(x,j)+T(x,j+1)));
+    setGasStateAtMidpoint(*m_thermo, m_ybar.data(), x, j);
+}
+
+void Flow1D::setGasState(ThermoPhase& thermo, const double* x, size_t j) const
+{
+    thermo.setTemperature(T(x,j));
+    const double* yy = x + m_nv*j + c_offset_Y;
+    thermo.setMassFractions_NoNorm(yy);
+    thermo.setPressure(m_press);
+}
+
+void Flow1D::setGasStateAtMidpoint(ThermoPhase& thermo, double* ybar, const double* x,
+                                   size_t j) const
+{
+    thermo.setTemperature(0.5*(T(x,j)+T(x,j+1)));
     const double* yy_j = x + m_nv*j + c_offset_Y;
     const double* yy_j_plus1 = x + m_nv*(j+1) + c_offset_Y;
     for (size_t k = 0; k < m_nsp; k++) {
-        m_ybar[k] = 0.5*(yy_j[k] + yy_j_plus1[k]);
+        ybar[k] = 0.5*(yy_j[k] + yy_j_plus1[k]);
     }
-    m_thermo->setMassFractions_NoNorm(m_ybar.data());
-    m_thermo->setPressure(m_press);
+    thermo.setMassFractions_NoNorm(ybar);
+    thermo.setPressure(m_press);
+}
+
+void Flow1D::setNumThreads(size_t nThreads)
+{
+    if (!m_solution) {
+        throw CanteraError("Flow1D::setNumThreads",
+            "Multithreaded evaluation requires an associated Solution object.");
+    }
+    m_pool.reset();
+    if (nThreads != 1) {
+        m_pool = make_unique<ThreadPool>(nThreads);
+        if (m_pool->size() == 1) {
+            m_pool.reset();
+        }
+    }
+    updateThreadSolutions();
+}
+
+size_t Flow1D::numThreads() const
+{
+    return m_pool ? m_pool->size() : 1;
+}
+
+void Flow1D::updateThreadSolutions()
+{
+    m_threadSolutions.clear();
+    m_threadYbar.clear();
+    m_threadHf298.clear();
+    if (!m_pool) {
+        return;
+    }
+    for (size_t i = 1; i < m_pool->size(); i++) {
+        m_threadSolutions.push_back(m_solution->clone());
+        m_threadYbar.emplace_back(m_nsp);
+    }
+    try {
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_threadHf298.push_back(m_thermo->Hf298SS(k));
+        }
+    } catch (NotImplementedError&) {
+        // heats of formation cannot be modified for this species thermo model
+        m_threadHf298.clear();
+    }
+}
+
+void Flow1D::syncThreadSolutions()
+{
+    if (m_threadSolutions.empty()) {
+        return;
+    }
+    for (size_t i = 0; i < m_kin->nReactions(); i++) {
+        double multiplier = m_kin->multiplier(i);
+        for (auto& sol : m_threadSolutions) {
+            if (sol->kinetics()->multiplier(i) != multiplier) {
+                sol->kinetics()->setMultiplier(i, multiplier);
+            }
+        }
+    }
+    // Compare with the values which were copied, since the values reported by the
+    // copies may differ due to round-off
+    for (size_t k = 0; k < m_threadHf298.size(); k++) {
+        double Hf298 = m_thermo->Hf298SS(k);
+        if (Hf298 != m_threadHf298[k]) {
+            for (auto& sol : m_threadSolutions) {
+                sol->thermo()->modifyOneHf298SS(k, Hf298);
+            }
+            m_threadHf298[k] = Hf298;
+        }
+    }
+}
+
+void Flow1D::forEachPoint(size_t j0, size_t j1,
+                          const function<void(size_t, size_t)>& func)
+{
+    if (!m_pool || j1 < j0 + 2 * m_pool->size()) {
+        // Not worth distributing a small number of points, for example when
+        // evaluating the residual for a single Jacobian column
+        for (size_t j = j0; j < j1; j++) {
+            func(j, 0);
+        }
+        return;
+    }
+    m_pool->parallelFor(j1 - j0, [&](size_t i, size_t thread) {
+        func(j0 + i, thread);
+    });
 }
 
 void Flow1D::_finalize(const double* x)
@@ -370,41 +483,175 @@ void Flow1D::updateProperties(size_t jg, double* x, size_t jmin, size_t jmax)
     updateDiffFluxes(x, j0, j1);
 }
 
+void Flow1D::updateThermo(const double* x, size_t j0, size_t j1)
+{
+    syncThreadSolutions();
+    forEachPoint(j0, j1 + 1, [&](size_t j, size_t thread) {
+        auto& thermo = thread ? *m_threadSolutions[thread-1]->thermo() : *m_thermo;
+        auto& kin = thread ? *m_threadSolutions[thread-1]->kinetics() : *m_kin;
+        setGasState(thermo, x, j);
+        m_rho[j] = thermo.density();
+        m_wtm[j] = thermo.meanMolecularWeight();
+        m_cp[j] = thermo.cp_mass();
+        thermo.getPartialMolarEnthalpies(&m_hk(0, j));
+        if (m_linearizedChem) {
+            double* work = thread ? m_threadYbar[thread-1].data() : m_ybar.data();
+            linearizedProductionRates(x, j, &m_wdot(0, j), work);
+        } else {
+            kin.getNetProductionRates(&m_wdot(0, j));
+        }
+    });
+}
+
+void Flow1D::startJacobianEvaluation(const double* xGlobal)
+{
+    m_evaluatingJacobian = true;
+    if (!m_analyticChemJac) {
+        return;
+    }
+    // Production rates at the unperturbed state were calculated by the preceding
+    // residual evaluation
+    const double* x = xGlobal + loc();
+    m_x0.assign(x, x + size());
+    m_wdot0 = m_wdot;
+    m_dwdot_dT.resize(m_nsp, m_points);
+    m_dwdot_dX_X.resize(m_nsp, m_points);
+    m_dwdot_dX.resize(m_points);
+    syncThreadSolutions();
+    // Derivatives are only needed at interior points, where the species and energy
+    // equations include chemical source terms
+    forEachPoint(1, m_points - 1, [&](size_t j, size_t thread) {
+        auto& thermo = thread ? *m_threadSolutions[thread-1]->thermo() : *m_thermo;
+        auto& kin = thread ? *m_threadSolutions[thread-1]->kinetics() : *m_kin;
+        setGasState(thermo, x, j);
+        m_dwdot_dX[j] = kin.netProductionRates_ddX();
+
+        // temperature derivative at constant pressure includes the change of the
+        // molar density
+        double* dwdot_dT = &m_dwdot_dT(0, j);
+        kin.getNetProductionRates_ddT(dwdot_dT);
+        vector<double> dwdot_dC(m_nsp);
+        kin.getNetProductionRates_ddC(dwdot_dC.data());
+        double dC_dT = - thermo.molarDensity() * thermo.thermalExpansionCoeff();
+        for (size_t k = 0; k < m_nsp; k++) {
+            dwdot_dT[k] += dwdot_dC[k] * dC_dT;
+        }
+
+        vector<double> X(m_nsp);
+        thermo.getMoleFractions(X.data());
+        Eigen::Map<Eigen::VectorXd>(&m_dwdot_dX_X(0, j), m_nsp) =
+            m_dwdot_dX[j] * Eigen::Map<Eigen::VectorXd>(X.data(), m_nsp);
+    });
+    m_linearizedChem = true;
+}
+
+void Flow1D::finishJacobianEvaluation()
+{
+    m_evaluatingJacobian = false;
+    m_linearizedChem = false;
+}
+
+void Flow1D::linearizedProductionRates(const double* x, size_t j, double* wdot,
+                                       double* work) const
+{
+    const double* wdot0 = m_wdot0.ptrColumn(j);
+    copy(wdot0, wdot0 + m_nsp, wdot);
+    if (j == 0 || j == m_points - 1) {
+        return;
+    }
+
+    // temperature contribution
+    double dT = T(x, j) - T(m_x0.data(), j);
+    for (size_t k = 0; k < m_nsp; k++) {
+        wdot[k] += m_dwdot_dT(k, j) * dT;
+    }
+
+    // Mass fraction contribution, where the change in mole fractions is
+    //     dX_k = Wmix * (dY_k / W_k - X_k * sum_i(dY_i / W_i))
+    double sum0 = 0.0;
+    double dsum = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        sum0 += Y(m_x0.data(), k, j) / m_wt[k];
+        work[k] = (Y(x, k, j) - Y(m_x0.data(), k, j)) / m_wt[k];
+        dsum += work[k];
+    }
+    double wtm = 1.0 / sum0;
+    Eigen::Map<Eigen::VectorXd> dwdot(wdot, m_nsp);
+    dwdot += wtm * (m_dwdot_dX[j] * Eigen::Map<Eigen::VectorXd>(work, m_nsp));
+    for (size_t k = 0; k < m_nsp; k++) {
+        wdot[k] -= wtm * dsum * m_dwdot_dX_X(k, j);
+    }
+}
+
 void Flow1D::updateTransport(double* x, size_t j0, size_t j1)
 {
-     if (m_do_multicomponent) {
-        for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            double wtm = m_thermo->meanMolecularWeight();
-            double rho = m_thermo->density();
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
+    forEachPoint(j0, j1, [&](size_t j, size_t thread) {
+        auto& thermo = thread ? *m_threadSolutions[thread-1]->thermo() : *m_thermo;
+        auto& trans = thread ? *m_threadSolutions[thread-1]->transport() : *m_trans;
+        double* ybar = thread ? m_threadYbar[thread-1].data() : m_ybar.data();
+        setGasStateAtMidpoint(thermo, ybar, x, j);
+        if (m_iterativeMultiDiff) {
+            m_visc[j] = (m_dovisc ? trans.viscosity() : 0.0);
+            // While evaluating the Jacobian, the Stefan-Maxwell system and its
+            // solution for the unperturbed state are kept, and only the change in
+            // the diffusive fluxes is computed by updateDiffFluxes().
+            if (!m_evaluatingJacobian) {
+                double rho = thermo.density();
+                double pressure = thermo.pressure();
+                auto& multiTrans = dynamic_cast<MultiTransport&>(trans);
+                double* v = m_multiWeights.ptrColumn(j);
+                multiTrans.getStefanMaxwellSystem(m_nsp, &m_multidiff[mindex(0,0,j)],
+                                                  v);
+
+                // Use m_diff as storage for the factor converting diffusion
+                // velocities to mass fluxes
+                for (size_t k = 0; k < m_nsp; k++) {
+                    m_diff[k+j*m_nsp] = rho * v[k] / pressure;
+                }
+
+                // Solve the Stefan-Maxwell equations for the current mole fraction
+                // differences, using the previous solution as the initial guess
+                double* dX = m_diffDeltaX.ptrColumn(j);
+                for (size_t k = 0; k < m_nsp; k++) {
+                    dX[k] = X(x,k,j+1) - X(x,k,j);
+                }
+                MultiTransport::solveStefanMaxwell(m_nsp,
+                    &m_multidiff[mindex(0,0,j)], m_nsp, v, dX,
+                    m_diffVelocity.ptrColumn(j));
+            }
+
+            m_tcon[j] = trans.thermalConductivity();
+            if (m_do_soret) {
+                trans.getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + j*m_nsp);
+            }
+        } else if (m_do_multicomponent) {
+            double wtm = thermo.meanMolecularWeight();
+            double rho = thermo.density();
+            m_visc[j] = (m_dovisc ? trans.viscosity() : 0.0);
+            trans.getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
 
             // Use m_diff as storage for the factor outside the summation
             for (size_t k = 0; k < m_nsp; k++) {
                 m_diff[k+j*m_nsp] = m_wt[k] * rho / (wtm*wtm);
             }
 
-            m_tcon[j] = m_trans->thermalConductivity();
+            m_tcon[j] = trans.thermalConductivity();
             if (m_do_soret) {
-                m_trans->getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + j*m_nsp);
+                trans.getThermalDiffCoeffs(m_dthermal.ptrColumn(0) + j*m_nsp);
             }
-        }
-    } else { // mixture averaged transport
-        for (size_t j = j0; j < j1; j++) {
-            setGasAtMidpoint(x,j);
-            m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
+        } else { // mixture averaged transport
+            m_visc[j] = (m_dovisc ? trans.viscosity() : 0.0);
 
             if (m_fluxGradientBasis == ThermoBasis::molar) {
-                m_trans->getMixDiffCoeffs(&m_diff[j*m_nsp]);
+                trans.getMixDiffCoeffs(&m_diff[j*m_nsp]);
             } else {
-                m_trans->getMixDiffCoeffsMass(&m_diff[j*m_nsp]);
+                trans.getMixDiffCoeffsMass(&m_diff[j*m_nsp]);
             }
 
-            double rho = m_thermo->density();
+            double rho = thermo.density();
 
             if (m_fluxGradientBasis == ThermoBasis::molar) {
-                double wtm = m_thermo->meanMolecularWeight();
+                double wtm = thermo.meanMolecularWeight();
                 for (size_t k=0; k < m_nsp; k++) {
                     m_diff[k+j*m_nsp] *= m_wt[k] * rho / wtm;
                 }
@@ -413,14 +660,40 @@ void Flow1D::updateTransport(double* x, size_t j0, size_t j1)
                     m_diff[k+j*m_nsp] *= rho;
                 }
             }
-            m_tcon[j] = m_trans->thermalConductivity();
+            m_tcon[j] = trans.thermalConductivity();
         }
-    }
+    });
 }
 
 void Flow1D::updateDiffFluxes(const double* x, size_t j0, size_t j1)
 {
-    if (m_do_multicomponent) {
+    if (m_iterativeMultiDiff) {
+        forEachPoint(j0, j1, [&](size_t j, size_t thread) {
+            // The Stefan-Maxwell equations are linear in the mole fraction
+            // differences, so only the correction to the solution computed by
+            // updateTransport() needs to be found. Solving for the correction
+            // keeps the error proportional to the change in the mole fraction
+            // differences, which is required for accurate finite difference
+            // Jacobians.
+            double dz = z(j+1) - z(j);
+            const double* dX0 = m_diffDeltaX.ptrColumn(j);
+            const double* V0 = m_diffVelocity.ptrColumn(j);
+            vector<double> ddX(m_nsp), dV(m_nsp, 0.0);
+            bool changed = false;
+            for (size_t k = 0; k < m_nsp; k++) {
+                ddX[k] = X(x,k,j+1) - X(x,k,j) - dX0[k];
+                changed |= (ddX[k] != 0.0);
+            }
+            if (changed) {
+                MultiTransport::solveStefanMaxwell(m_nsp,
+                    &m_multidiff[mindex(0,0,j)], m_nsp, m_multiWeights.ptrColumn(j),
+                    ddX.data(), dV.data());
+            }
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_flux(k,j) = m_diff[k+j*m_nsp] * (V0[k] + dV[k]) / dz;
+            }
+        });
+    } else if (m_do_multicomponent) {
         for (size_t j = j0; j < j1; j++) {
             double dz = z(j+1) - z(j);
             for (size_t k = 0; k < m_nsp; k++) {
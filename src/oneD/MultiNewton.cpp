@@ -35,7 +35,11 @@ void MultiNewton::step(double* x, double* step, SteadyStateSystem& r, int loglev
 
     auto jac = r.linearSolver();
     try {
-        jac->solve(r.size(), step, step);
+        if (r.jacobianFree()) {
+            krylovStep(x, step, r, loglevel);
+        } else {
+            jac->solve(r.size(), step, step);
+        }
     } catch (CanteraError&) {
         if (jac->info() > 0) {
             // Positive value for "info" indicates the row where factorization failed
@@ -48,6 +52,161 @@ void MultiNewton::step(double* x, double* step, SteadyStateSystem& r, int loglev
     }
 }
 
+void MultiNewton::krylovStep(double* x, double* step, SteadyStateSystem& r,
+                             int loglevel)
+{
+    // GMRES is applied to the left-preconditioned system W P^{-1} J W^{-1} y =
+    // W P^{-1} b, where P is the preconditioner and W is the diagonal matrix of
+    // inverse error weights, such that the 2-norm of the linear residual is
+    // consistent with the weighted norm used to measure the Newton step.
+    size_t n = r.size();
+    size_t mmax = std::max<size_t>(m_krylovMaxIter, 1);
+    auto jac = r.linearSolver();
+    m_krylovF.resize(n);
+    m_krylovWork.resize(n);
+    m_krylovEwt.resize(n);
+    m_krylovBasis.resize(mmax + 1);
+    for (auto& v : m_krylovBasis) {
+        v.resize(n);
+    }
+    r.getErrorWeights(m_krylovEwt.data());
+
+    // On entry, 'step' holds the right hand side -F(x)
+    double xnorm = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        m_krylovF[i] = -step[i];
+        xnorm += x[i] * x[i];
+    }
+    xnorm = sqrt(xnorm);
+    vector<double>& v0 = m_krylovBasis[0];
+    jac->solve(n, step, v0.data());
+    double beta = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        v0[i] /= m_krylovEwt[i];
+        beta += v0[i] * v0[i];
+    }
+    beta = sqrt(beta);
+    std::fill(step, step + n, 0.0);
+    if (beta == 0.0) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        v0[i] /= beta;
+    }
+
+    // Hessenberg matrix (column-major), Givens rotations, and the rotated residual
+    vector<double> H((mmax + 1) * mmax, 0.0);
+    vector<double> cs(mmax), sn(mmax), g(mmax + 1, 0.0);
+    g[0] = beta;
+    double eps = sqrt(std::numeric_limits<double>::epsilon());
+    double resid = beta;
+    bool converged = false;
+    size_t k = 0;
+    while (k < mmax) {
+        // Directional derivative J z ~ (F(x + sigma z) - F(x)) / sigma, where
+        // z = W^{-1} v_k. The perturbed state is stored temporarily in the next
+        // basis vector.
+        vector<double>& w = m_krylovBasis[k+1];
+        const vector<double>& vk = m_krylovBasis[k];
+        double znorm = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            double z = vk[i] * m_krylovEwt[i];
+            znorm += z * z;
+        }
+        znorm = sqrt(znorm);
+        if (znorm == 0.0) {
+            std::fill(w.begin(), w.end(), 0.0);
+        } else {
+            double sigma = eps * (1.0 + xnorm) / znorm;
+            for (size_t i = 0; i < n; i++) {
+                w[i] = x[i] + sigma * vk[i] * m_krylovEwt[i];
+            }
+            r.eval(w.data(), m_krylovWork.data());
+            for (size_t i = 0; i < n; i++) {
+                m_krylovWork[i] = (m_krylovWork[i] - m_krylovF[i]) / sigma;
+            }
+            // Apply the preconditioner and scaling
+            jac->solve(n, m_krylovWork.data(), w.data());
+            for (size_t i = 0; i < n; i++) {
+                w[i] /= m_krylovEwt[i];
+            }
+        }
+
+        // Modified Gram-Schmidt orthogonalization
+        double* h = &H[k * (mmax + 1)];
+        for (size_t j = 0; j <= k; j++) {
+            const auto& v = m_krylovBasis[j];
+            double dot = 0.0;
+            for (size_t i = 0; i < n; i++) {
+                dot += w[i] * v[i];
+            }
+            h[j] = dot;
+            for (size_t i = 0; i < n; i++) {
+                w[i] -= dot * v[i];
+            }
+        }
+        double wnorm = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            wnorm += w[i] * w[i];
+        }
+        wnorm = sqrt(wnorm);
+        h[k+1] = wnorm;
+
+        // Apply previous Givens rotations to the new column, then eliminate the
+        // subdiagonal element
+        for (size_t j = 0; j < k; j++) {
+            double tmp = cs[j] * h[j] + sn[j] * h[j+1];
+            h[j+1] = -sn[j] * h[j] + cs[j] * h[j+1];
+            h[j] = tmp;
+        }
+        double denom = hypot(h[k], h[k+1]);
+        cs[k] = (denom == 0.0) ? 1.0 : h[k] / denom;
+        sn[k] = (denom == 0.0) ? 0.0 : h[k+1] / denom;
+        h[k] = denom;
+        h[k+1] = 0.0;
+        g[k+1] = -sn[k] * g[k];
+        g[k] = cs[k] * g[k];
+        resid = fabs(g[k+1]);
+        k++;
+
+        if (resid <= m_krylovRtol * beta || wnorm == 0.0) {
+            converged = true;
+            break;
+        }
+        for (size_t i = 0; i < n; i++) {
+            w[i] /= wnorm;
+        }
+    }
+    m_krylovIters += static_cast<int>(k);
+    if (!converged) {
+        m_krylovFails++;
+    }
+    if (loglevel > 0) {
+        writelog("\n  GMRES: {} iterations, relative residual {:9.3e}{}", k,
+                 resid / beta, converged ? "" : " (not converged)");
+    }
+
+    // Solve the upper triangular system H y = g and form the step W^{-1} V y
+    vector<double> y(k);
+    for (size_t j = k; j-- > 0;) {
+        double sum = g[j];
+        for (size_t l = j + 1; l < k; l++) {
+            sum -= H[l * (mmax + 1) + j] * y[l];
+        }
+        double diag = H[j * (mmax + 1) + j];
+        y[j] = (diag == 0.0) ? 0.0 : sum / diag;
+    }
+    for (size_t j = 0; j < k; j++) {
+        const auto& v = m_krylovBasis[j];
+        for (size_t i = 0; i < n; i++) {
+            step[i] += y[j] * v[i];
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        step[i] *= m_krylovEwt[i];
+    }
+}
+
 double MultiNewton::boundStep(const double* x0, const double* step0, const SteadyStateSystem& r,
                               int loglevel)
 {
@@ -123,6 +123,27 @@ double OneDim::weightedNorm(const double* step) const
     return sqrt(sum / size());
 }
 
+void OneDim::getErrorWeights(double* ewt) const
+{
+    const double* x = m_state->data();
+    for (size_t n = 0; n < nDomains(); n++) {
+        Domain1D& dom = domain(n);
+        size_t nv = dom.nComponents();
+        size_t np = dom.nPoints();
+        size_t dstart = start(n);
+        for (size_t i = 0; i < nv; i++) {
+            double esum = 0.0;
+            for (size_t j = 0; j < np; j++) {
+                esum += fabs(x[dstart + nv*j + i]);
+            }
+            double w = dom.rtol(i)*esum/np + dom.atol(i);
+            for (size_t j = 0; j < np; j++) {
+                ewt[dstart + nv*j + i] = w;
+            }
+        }
+    }
+}
+
 MultiJac& OneDim::jacobian()
 {
     warn_deprecated("OneDim::jacobian",
@@ -138,17 +159,25 @@ MultiJac& OneDim::jacobian()
 void OneDim::writeStats(int printTime)
 {
     saveStats();
-    writelog("\nStatistics:\n\n Grid   Timesteps  Functions      Time  Jacobians      Time\n");
+    bool krylov = std::any_of(m_krylovIters.begin(), m_krylovIters.end(),
+                              [](int iters) { return iters > 0; });
+    writelog("\nStatistics:\n\n Grid   Timesteps  Functions      Time  Jacobians      Time");
+    writelog(krylov ? "  GMRES iters\n" : "\n");
     size_t n = m_gridpts.size();
     for (size_t i = 0; i < n; i++) {
         if (printTime) {
-            writelog("{:5d}       {:5d}     {:6d} {:9.4f}      {:5d} {:9.4f}\n",
+            writelog("{:5d}       {:5d}     {:6d} {:9.4f}      {:5d} {:9.4f}",
                      m_gridpts[i], m_timeSteps[i], m_funcEvals[i], m_funcElapsed[i],
                      m_jacEvals[i], m_jacElapsed[i]);
         } else {
-            writelog("{:5d}       {:5d}     {:6d}        NA      {:5d}        NA\n",
+            writelog("{:5d}       {:5d}     {:6d}        NA      {:5d}        NA",
                      m_gridpts[i], m_timeSteps[i], m_funcEvals[i], m_jacEvals[i]);
         }
+        if (krylov) {
+            writelog("  {:11d}\n", m_krylovIters[i]);
+        } else {
+            writelog("\n");
+        }
     }
 }
 
@@ -166,6 +195,8 @@ void OneDim::saveStats()
             m_evaltime = 0.0;
             m_timeSteps.push_back(m_nsteps);
             m_nsteps = 0;
+            m_krylovIters.push_back(newton().nKrylovIterations());
+            newton().clearKrylovStats();
         }
     }
 }
@@ -178,6 +209,8 @@ void OneDim::clearStats()
     m_funcEvals.clear();
     m_funcElapsed.clear();
     m_timeSteps.clear();
+    m_krylovIters.clear();
+    newton().clearKrylovStats();
     m_nevals = 0;
     m_evaltime = 0.0;
     m_nsteps = 0;
@@ -287,6 +320,32 @@ void OneDim::evalJacobian(double* x0)
     m_work1.resize(size());
     m_work2.resize(size());
     eval(npos, x0, m_work1.data(), 0.0, 0);
+    for (const auto& d : m_dom) {
+        d->startJacobianEvaluation(x0);
+    }
+    try {
+        if (m_coloredJacobian) {
+            evalColoredJacobian(x0);
+        } else {
+            evalJacobianColumns(x0);
+        }
+    } catch (...) {
+        for (const auto& d : m_dom) {
+            d->finishJacobianEvaluation();
+        }
+        throw;
+    }
+    for (const auto& d : m_dom) {
+        d->finishJacobianEvaluation();
+    }
+
+    m_jac->updateElapsed(double(clock() - t0) / CLOCKS_PER_SEC);
+    m_jac->incrementEvals();
+    m_jac->setAge(0);
+}
+
+void OneDim::evalJacobianColumns(double* x0)
+{
     size_t ipt = 0;
     for (size_t j = 0; j < points(); j++) {
         size_t nv = nVars(j);
@@ -303,8 +362,11 @@ void OneDim::evalJacobian(double* x0)
             // calculate perturbed residual
             eval(j, x0, m_work2.data(), 0.0, 0);
 
-            // compute nth column of Jacobian
-            for (size_t i = j - 1; i != j+2; i++) {
+            // compute nth column of Jacobian. Only the diagonal block is needed for
+            // the preconditioner used by the Jacobian-free Newton-Krylov method.
+            size_t iFirst = m_jacobianFree ? j : j - 1;
+            size_t iLast = m_jacobianFree ? j + 1 : j + 2;
+            for (size_t i = iFirst; i != iLast; i++) {
                 if (i != npos && i < points()) {
                     size_t mv = nVars(i);
                     size_t iloc = loc(i);
@@ -320,10 +382,70 @@ void OneDim::evalJacobian(double* x0)
             ipt++;
         }
     }
+}
 
-    m_jac->updateElapsed(double(clock() - t0) / CLOCKS_PER_SEC);
-    m_jac->incrementEvals();
-    m_jac->setAge(0);
+void OneDim::evalColoredJacobian(double* x0)
+{
+    // The residual at each point depends only on the solution at that point and its
+    // immediate neighbors. Points that are three apart therefore have disjoint
+    // domains of influence and can be perturbed simultaneously. If only the diagonal
+    // blocks are needed (for the Jacobian-free Newton-Krylov preconditioner), points
+    // that are two apart can be perturbed simultaneously.
+    size_t nColors = m_jacobianFree ? 2 : 3;
+    size_t nvMax = 0;
+    for (size_t j = 0; j < points(); j++) {
+        nvMax = std::max(nvMax, nVars(j));
+    }
+    vector<double> xsave(points()), rdx(points());
+    for (size_t color = 0; color < nColors; color++) {
+        for (size_t n = 0; n < nvMax; n++) {
+            bool perturbed = false;
+            for (size_t j = color; j < points(); j += nColors) {
+                if (n >= nVars(j)) {
+                    continue;
+                }
+                // perturb x(n) at point j; preserve sign(x(n))
+                size_t ipt = loc(j) + n;
+                xsave[j] = x0[ipt];
+                double dx = fabs(xsave[j]) * m_jacobianRelPerturb + m_jacobianAbsPerturb;
+                if (xsave[j] < 0) {
+                    dx = -dx;
+                }
+                x0[ipt] = xsave[j] + dx;
+                rdx[j] = 1.0 / (x0[ipt] - xsave[j]);
+                perturbed = true;
+            }
+            if (!perturbed) {
+                continue;
+            }
+
+            // calculate perturbed residual for all points of this color at once
+            eval(npos, x0, m_work2.data(), 0.0, 0);
+
+            // compute nth column of Jacobian for each perturbed point
+            for (size_t j = color; j < points(); j += nColors) {
+                if (n >= nVars(j)) {
+                    continue;
+                }
+                size_t ipt = loc(j) + n;
+                size_t iFirst = m_jacobianFree ? j : j - 1;
+                size_t iLast = m_jacobianFree ? j + 1 : j + 2;
+                for (size_t i = iFirst; i != iLast; i++) {
+                    if (i != npos && i < points()) {
+                        size_t mv = nVars(i);
+                        size_t iloc = loc(i);
+                        for (size_t m = 0; m < mv; m++) {
+                            double delta = m_work2[m+iloc] - m_work1[m+iloc];
+                            if (std::abs(delta) > m_jacobianThreshold || m+iloc == ipt) {
+                                m_jac->setValue(m + iloc, ipt, delta * rdx[j]);
+                            }
+                        }
+                    }
+                }
+                x0[ipt] = xsave[j];
+            }
+        }
+    }
 }
 
 void OneDim::initTimeInteg(double dt, double* x)
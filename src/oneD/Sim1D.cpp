@@ -7,6 +7,8 @@
 
 #include "cantera/oneD/Sim1D.h"
 #include "cantera/oneD/MultiJac.h"
+#include "cantera/numerics/EigenSparseJacobian.h"
+#include "cantera/numerics/eigen_dense.h"
 #include "cantera/oneD/Flow1D.h"
 #include "cantera/oneD/MultiNewton.h"
 #include "cantera/oneD/refine.h"
@@ -822,9 +824,21 @@ void Sim1D::solveAdjoint(const double* b, double* lambda)
         D->forceFullUpdate(false);
     }
 
+    if (auto sparse = dynamic_pointer_cast<EigenSparseJacobian>(m_jac)) {
+        Eigen::SparseMatrix<double> Jt = sparse->jacobian().transpose();
+        Eigen::SparseLU<Eigen::SparseMatrix<double>> solver(Jt);
+        if (solver.info() != Eigen::Success) {
+            throw CanteraError("Sim1D::solveAdjoint", "Factorization failed: {}",
+                               solver.lastErrorMessage());
+        }
+        MappedVector(lambda, size()) = solver.solve(ConstMappedVector(b, size()));
+        return;
+    }
+
     auto multijac = dynamic_pointer_cast<MultiJac>(m_jac);
     if (!multijac) {
-        throw CanteraError("Sim1D::solveAdjoint", "Banded (MultiJac) required");
+        throw CanteraError("Sim1D::solveAdjoint",
+                           "Banded (MultiJac) or Eigen sparse Jacobian required");
     }
     // Form J^T
     size_t bw = bandwidth();
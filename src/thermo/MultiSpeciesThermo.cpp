@@ -10,6 +10,8 @@
 
 #include "cantera/thermo/MultiSpeciesThermo.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/NasaPoly2.h"
+#include "cantera/thermo/Nasa9PolyMultiTempRegion.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/ctexceptions.h"
@@ -40,14 +42,12 @@ void MultiSpeciesThermo::install_STIT(size_t index,
     int type = stit_ptr->reportType();
     m_speciesLoc[index] = {type, m_sp[type].size()};
     m_sp[type].emplace_back(index, stit_ptr);
-    if (m_sp[type].size() == 1) {
-        m_tpoly[type].resize(stit_ptr->temperaturePolySize());
-    }
 
     // Calculate max and min T
     m_tlow_max = std::max(stit_ptr->minTemp(), m_tlow_max);
     m_thigh_min = std::min(stit_ptr->maxTemp(), m_thigh_min);
     markInstalled(index);
+    m_packedStale = true;
 }
 
 void MultiSpeciesThermo::modifySpecies(size_t index,
@@ -80,6 +80,7 @@ void MultiSpeciesThermo::modifySpecies(size_t index,
     }
 
     m_sp[type][m_speciesLoc[index].second] = {index, spthermo};
+    m_packedStale = true;
 }
 
 void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
@@ -93,11 +94,43 @@ void MultiSpeciesThermo::update_single(size_t k, double t, double* cp_R,
 
 void MultiSpeciesThermo::update(double t, double* cp_R, double* h_RT, double* s_R) const
 {
-    auto iter = m_sp.begin();
-    auto jter = m_tpoly.begin();
-    for (; iter != m_sp.end(); iter++, jter++) {
-        const vector<index_STIT>& species = iter->second;
-        double* tpoly = &jter->second[0];
+    if (m_packedStale) {
+        packCoefficients();
+    }
+    update(t, cp_R, h_RT, s_R, m_work);
+}
+
+void MultiSpeciesThermo::update(double t, double* cp_R, double* h_RT, double* s_R,
+                                vector<double>& work) const
+{
+    if (m_packedStale) {
+        // Packed tables are only rebuilt by update() without a work array, which
+        // would otherwise modify this object
+        for (const auto& [type, species] : m_sp) {
+            for (const auto& [i, spthermo] : species) {
+                spthermo->updatePropertiesTemp(t, cp_R+i, h_RT+i, s_R+i);
+            }
+        }
+        return;
+    }
+    size_t nWork = std::max(3 * m_nasa7.size(), 12 * m_nasa9.size());
+    for (const auto& [type, species] : m_sp) {
+        nWork = std::max(nWork, species[0].second->temperaturePolySize());
+    }
+    if (work.size() < nWork) {
+        work.resize(nWork);
+    }
+    if (m_nasa7.size()) {
+        updateNasa7(t, cp_R, h_RT, s_R, work.data());
+    }
+    if (m_nasa9.size()) {
+        updateNasa9(t, cp_R, h_RT, s_R, work.data());
+    }
+    for (const auto& [type, species] : m_sp) {
+        if (m_packedTypes.count(type)) {
+            continue;
+        }
+        double* tpoly = work.data();
         species[0].second->updateTemperaturePoly(t, tpoly);
         for (auto& [i, spthermo] : species) {
             spthermo->updateProperties(tpoly, cp_R+i, h_RT+i, s_R+i);
@@ -105,6 +138,196 @@ void MultiSpeciesThermo::update(double t, double* cp_R, double* h_RT, double* s_
     }
 }
 
+void MultiSpeciesThermo::updateNasa7(double t, double* cp_R, double* h_RT,
+                                     double* s_R, double* work) const
+{
+    // Temperature polynomial as used by NasaPoly1
+    double tt[6];
+    tt[0] = t;
+    tt[1] = t * t;
+    tt[2] = tt[1] * t;
+    tt[3] = tt[2] * t;
+    tt[4] = 1.0 / t;
+    tt[5] = std::log(t);
+
+    // Entries are sorted by mid-point temperature: species with T_mid < T use
+    // their high-temperature coefficients, all others use low-temperature ones
+    size_t n = m_nasa7.size();
+    const double* Tmid = m_nasa7.bounds.data();
+    size_t nHigh = std::lower_bound(Tmid, Tmid + n, t) - Tmid;
+    double* cp = work;
+    double* h = work + n;
+    double* s = work + 2 * n;
+    for (size_t r = 0; r < 2; r++) {
+        // region 0 holds low-temperature coefficients
+        size_t start = (r == 0) ? nHigh : 0;
+        size_t end = (r == 0) ? n : nHigh;
+        const double* a = m_nasa7.coeffs.data() + 7 * r * n;
+        for (size_t i = start; i < end; i++) {
+            double ct0 = a[i]; // a0
+            double ct1 = a[n + i] * tt[0]; // a1 * T
+            double ct2 = a[2 * n + i] * tt[1]; // a2 * T^2
+            double ct3 = a[3 * n + i] * tt[2]; // a3 * T^3
+            double ct4 = a[4 * n + i] * tt[3]; // a4 * T^4
+            cp[i] = ct0 + ct1 + ct2 + ct3 + ct4;
+            h[i] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4
+                   + a[5 * n + i] * tt[4]; // last term is a5/T
+            s[i] = ct0*tt[5] + ct1 + 0.5*ct2 + 1.0/3.0*ct3
+                   + 0.25*ct4 + a[6 * n + i]; // last term is a6
+        }
+    }
+
+    const size_t* index = m_nasa7.index.data();
+    for (size_t i = 0; i < n; i++) {
+        cp_R[index[i]] = cp[i];
+        h_RT[index[i]] = h[i];
+        s_R[index[i]] = s[i];
+    }
+}
+
+void MultiSpeciesThermo::updateNasa9(double t, double* cp_R, double* h_RT,
+                                     double* s_R, double* work) const
+{
+    // Temperature polynomial as used by Nasa9Poly1
+    double tt[7];
+    tt[0] = t;
+    tt[1] = t * t;
+    tt[2] = tt[1] * t;
+    tt[3] = tt[2] * t;
+    tt[4] = 1.0 / t;
+    tt[5] = tt[4] / t;
+    tt[6] = std::log(t);
+
+    // Select coefficients of the active temperature region of each species without
+    // branching; region bounds are increasing, so the last matching region wins.
+    size_t n = m_nasa9.size();
+    const double* coeffs = m_nasa9.coeffs.data();
+    double* a = work;
+    std::copy(coeffs, coeffs + 9 * n, a);
+    for (size_t r = 1; r < m_nasa9.nRegions; r++) {
+        const double* Tlow = m_nasa9.bounds.data() + (r - 1) * n;
+        const double* ar = coeffs + 9 * r * n;
+        for (size_t j = 0; j < 9; j++) {
+            for (size_t i = 0; i < n; i++) {
+                a[j * n + i] = (t >= Tlow[i]) ? ar[j * n + i] : a[j * n + i];
+            }
+        }
+    }
+
+    double* cp = work + 9 * n;
+    double* h = work + 10 * n;
+    double* s = work + 11 * n;
+    for (size_t i = 0; i < n; i++) {
+        double ct0 = a[i] * tt[5]; // a0 / (T^2)
+        double ct1 = a[n + i] * tt[4]; // a1 / T
+        double ct2 = a[2 * n + i]; // a2
+        double ct3 = a[3 * n + i] * tt[0]; // a3 * T
+        double ct4 = a[4 * n + i] * tt[1]; // a4 * T^2
+        double ct5 = a[5 * n + i] * tt[2]; // a5 * T^3
+        double ct6 = a[6 * n + i] * tt[3]; // a6 * T^4
+        cp[i] = ct0 + ct1 + ct2 + ct3 + ct4 + ct5 + ct6;
+        h[i] = -ct0 + tt[6]*ct1 + ct2 + 0.5*ct3 + 1.0/3.0*ct4
+               + 0.25*ct5 + 0.2*ct6 + a[7 * n + i] * tt[4];
+        s[i] = -0.5*ct0 - ct1 + tt[6]*ct2 + ct3 + 0.5*ct4
+               + 1.0/3.0*ct5 + 0.25*ct6 + a[8 * n + i];
+    }
+
+    const size_t* index = m_nasa9.index.data();
+    for (size_t i = 0; i < n; i++) {
+        cp_R[index[i]] = cp[i];
+        h_RT[index[i]] = h[i];
+        s_R[index[i]] = s[i];
+    }
+}
+
+void MultiSpeciesThermo::PackedNasa::reset(size_t nCoeffs_, size_t nRegions_, size_t n)
+{
+    nCoeffs = nCoeffs_;
+    nRegions = nRegions_;
+    index.assign(n, npos);
+    bounds.assign((nRegions - 1) * n, Undef);
+    coeffs.assign(nRegions * nCoeffs * n, 0.0);
+}
+
+void MultiSpeciesThermo::packCoefficients() const
+{
+    m_packedTypes.clear();
+    m_nasa7.reset(7, 2, 0);
+    m_nasa9.reset(9, 1, 0);
+    m_packedStale = false;
+
+    // Only species using the exact base parameterizations are packed, since derived
+    // classes may modify the evaluation of properties
+    auto packable = [](const vector<index_STIT>& species, const std::type_info& t) {
+        for (const auto& [k, spthermo] : species) {
+            if (typeid(*spthermo) != t) {
+                return false;
+            }
+        }
+        return true;
+    };
+    size_t nc;
+    int type;
+    double tlow, thigh, pref;
+
+    auto nasa7 = m_sp.find(NASA2);
+    if (nasa7 != m_sp.end() && packable(nasa7->second, typeid(NasaPoly2))) {
+        const auto& species = nasa7->second;
+        size_t n = species.size();
+        // Sort entries by mid-point temperature
+        vector<double> c(15);
+        vector<pair<double, size_t>> order;
+        for (size_t i = 0; i < n; i++) {
+            species[i].second->reportParameters(nc, type, tlow, thigh, pref, c.data());
+            order.emplace_back(c[0], i);
+        }
+        std::stable_sort(order.begin(), order.end());
+        m_nasa7.reset(7, 2, n);
+        for (size_t i = 0; i < n; i++) {
+            const auto& [k, spthermo] = species[order[i].second];
+            spthermo->reportParameters(nc, type, tlow, thigh, pref, c.data());
+            m_nasa7.index[i] = k;
+            m_nasa7.bounds[i] = c[0];
+            for (size_t j = 0; j < 7; j++) {
+                m_nasa7.coeffs[j * n + i] = c[8 + j]; // low-temperature region
+                m_nasa7.coeffs[(7 + j) * n + i] = c[1 + j]; // high-temperature region
+            }
+        }
+        m_packedTypes.insert(NASA2);
+    }
+
+    auto nasa9 = m_sp.find(NASA9MULTITEMP);
+    if (nasa9 != m_sp.end()
+        && packable(nasa9->second, typeid(Nasa9PolyMultiTempRegion)))
+    {
+        const auto& species = nasa9->second;
+        size_t n = species.size();
+        size_t nRegions = 1;
+        for (const auto& [k, spthermo] : species) {
+            nRegions = std::max(nRegions, (spthermo->nCoeffs() - 1) / 11);
+        }
+        m_nasa9.reset(9, nRegions, n);
+        for (size_t i = 0; i < n; i++) {
+            const auto& [k, spthermo] = species[i];
+            vector<double> c(spthermo->nCoeffs());
+            spthermo->reportParameters(nc, type, tlow, thigh, pref, c.data());
+            size_t nr = static_cast<size_t>(c[0]);
+            m_nasa9.index[i] = k;
+            for (size_t r = 0; r < nRegions; r++) {
+                if (r > 0) {
+                    // Padded regions are never selected
+                    m_nasa9.bounds[(r - 1) * n + i] = (r < nr) ? c[11 * r + 1] : BigNumber;
+                }
+                for (size_t j = 0; j < 9; j++) {
+                    m_nasa9.coeffs[(9 * r + j) * n + i] =
+                        c[11 * std::min(r, nr - 1) + 3 + j];
+                }
+            }
+        }
+        m_packedTypes.insert(NASA9MULTITEMP);
+    }
+}
+
 int MultiSpeciesThermo::reportType(size_t index) const
 {
     const SpeciesThermoInterpType* sp = provideSTIT(index);
@@ -189,6 +412,7 @@ void MultiSpeciesThermo::modifyOneHf298(const size_t k, const double Hf298New)
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
+        m_packedStale = true;
     }
 }
 
@@ -197,6 +421,7 @@ void MultiSpeciesThermo::resetHf298(const size_t k)
     SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
     if (sp_ptr) {
         sp_ptr->resetHf298();
+        m_packedStale = true;
     }
 }
 
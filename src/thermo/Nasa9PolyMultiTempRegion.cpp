@@ -116,30 +116,31 @@ void Nasa9PolyMultiTempRegion::updateTemperaturePoly(double T, double* T_poly) c
 void Nasa9PolyMultiTempRegion::updateProperties(const double* tt,
         double* cp_R, double* h_RT, double* s_R) const
 {
-    m_currRegion = 0;
+    size_t region = 0;
     for (size_t i = 1; i < m_regionPts.size(); i++) {
         if (tt[0] < m_lowerTempBounds[i]) {
             break;
         }
-        m_currRegion++;
+        region++;
     }
 
-    m_regionPts[m_currRegion]->updateProperties(tt, cp_R, h_RT, s_R);
+    m_regionPts[region]->updateProperties(tt, cp_R, h_RT, s_R);
 }
 
 void Nasa9PolyMultiTempRegion::updatePropertiesTemp(const double temp,
         double* cp_R, double* h_RT, double* s_R) const
 {
-    // Now find the region
-    m_currRegion = 0;
+    // Find the region; this is a local variable so that concurrent evaluations
+    // for the same object do not interfere
+    size_t region = 0;
     for (size_t i = 1; i < m_regionPts.size(); i++) {
         if (temp < m_lowerTempBounds[i]) {
             break;
         }
-        m_currRegion++;
+        region++;
     }
 
-    m_regionPts[m_currRegion]->updatePropertiesTemp(temp, cp_R, h_RT, s_R);
+    m_regionPts[region]->updatePropertiesTemp(temp, cp_R, h_RT, s_R);
 }
 
 size_t Nasa9PolyMultiTempRegion::nCoeffs() const
@@ -48,7 +48,10 @@ double Species::molecularWeight() {
 }
 
 void Species::setMolecularWeight(double weight) {
-    if (m_molecularWeight != Undef) {
+    if (weight == m_molecularWeight) {
+        // Don't write to species shared by several phases, see Solution::clone()
+        return;
+    } else if (m_molecularWeight != Undef) {
         double maxWeight = max(weight, m_molecularWeight);
         double weight_cmp = fabs(weight - m_molecularWeight) / maxWeight;
         if (weight_cmp > 1.0e-9) {
@@ -204,6 +204,42 @@ void addSpecies(ThermoPhase& thermo, const AnyValue& names, const AnyValue& spec
     }
 }
 
+//! Install the PDSS objects used by a VPStandardStateTP phase, based on the
+//! 'equation-of-state' field of each species definition
+void installPDSS(ThermoPhase& thermo)
+{
+    auto* vpssThermo = dynamic_cast<VPStandardStateTP*>(&thermo);
+    if (vpssThermo) {
+        for (size_t k = 0; k < thermo.nSpecies(); k++) {
+            unique_ptr<PDSS> pdss;
+            if (!thermo.species(k)->input.hasKey("equation-of-state")) {
+                throw InputFileError("setupPhase", thermo.species(k)->input,
+                    "Species '{}' in use by a ThermoPhase model of type '{}'\n"
+                    "must define an 'equation-of-state' field.",
+                    thermo.speciesName(k), thermo.type());
+            }
+            // Use the first node which specifies a valid PDSS model
+            auto& eos = thermo.species(k)->input["equation-of-state"];
+            bool found = false;
+            for (auto& node : eos.asVector<AnyMap>()) {
+                string model = node["model"].asString();
+                if (PDSSFactory::factory()->exists(model)) {
+                    pdss.reset(newPDSS(model));
+                    pdss->setParameters(node);
+                    found = true;
+                    break;
+                }
+            }
+            if (!found) {
+                throw InputFileError("setupPhase", eos,
+                    "Could not find an equation-of-state specification "
+                    "which defines a known PDSS model.");
+            }
+            vpssThermo->installPDSS(k, std::move(pdss));
+        }
+    }
+}
+
 void setupPhase(ThermoPhase& thermo, const AnyMap& phaseNode, const AnyMap& rootNode)
 {
     thermo.setName(phaseNode["name"].asString());
@@ -309,36 +345,7 @@ void setupPhase(ThermoPhase& thermo, const AnyMap& phaseNode, const AnyMap& root
         addSpecies(thermo, AnyValue("all"), rootNode["species"]);
     }
 
-    auto* vpssThermo = dynamic_cast<VPStandardStateTP*>(&thermo);
-    if (vpssThermo) {
-        for (size_t k = 0; k < thermo.nSpecies(); k++) {
-            unique_ptr<PDSS> pdss;
-            if (!thermo.species(k)->input.hasKey("equation-of-state")) {
-                throw InputFileError("setupPhase", thermo.species(k)->input,
-                    "Species '{}' in use by a ThermoPhase model of type '{}'\n"
-                    "must define an 'equation-of-state' field.",
-                    thermo.speciesName(k), thermo.type());
-            }
-            // Use the first node which specifies a valid PDSS model
-            auto& eos = thermo.species(k)->input["equation-of-state"];
-            bool found = false;
-            for (auto& node : eos.asVector<AnyMap>()) {
-                string model = node["model"].asString();
-                if (PDSSFactory::factory()->exists(model)) {
-                    pdss.reset(newPDSS(model));
-                    pdss->setParameters(node);
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                throw InputFileError("setupPhase", eos,
-                    "Could not find an equation-of-state specification "
-                    "which defines a known PDSS model.");
-            }
-            vpssThermo->installPDSS(k, std::move(pdss));
-        }
-    }
+    installPDSS(thermo);
 
     thermo.setParameters(phaseNode, rootNode);
     thermo.initThermo();
@@ -351,4 +358,64 @@ void setupPhase(ThermoPhase& thermo, const AnyMap& phaseNode, const AnyMap& root
     }
 }
 
+namespace {
+
+//! Create a Species object which shares the transport data of *spec*, but has its
+//! own copy of the species thermo object. This allows species thermo to be modified
+//! in place, for example by ThermoPhase::modifyOneHf298(), without affecting other
+//! phases.
+shared_ptr<Species> copySpecies(const Species& spec)
+{
+    auto copy = make_shared<Species>(spec.name, spec.composition, spec.charge,
+                                     spec.size);
+    copy->transport = spec.transport;
+    copy->input = spec.input;
+    if (spec.thermo->reportType() == 0) {
+        // placeholder used by species where the PDSS object provides the thermo
+        copy->thermo = make_shared<SpeciesThermoInterpType>();
+        return copy;
+    }
+    try {
+        // use current parameters, which include changes made after construction
+        AnyMap params = spec.thermo->parameters(false);
+        params.applyUnits();
+        copy->thermo = newSpeciesThermo(params);
+        copy->thermo->input() = spec.thermo->input();
+    } catch (CanteraError& err) {
+        throw NotImplementedError("setupPhase",
+            "Unable to copy thermo data of species '{}':\n{}",
+            spec.name, err.getMessage());
+    }
+    return copy;
+}
+
+} // end anonymous namespace
+
+void setupPhase(ThermoPhase& thermo, const ThermoPhase& other)
+{
+    if (dynamic_cast<const LatticeSolidPhase*>(&other)
+        || dynamic_cast<const PlasmaPhase*>(&other))
+    {
+        // these models use the root node of the input data, which is not retained
+        throw NotImplementedError("setupPhase",
+            "Copying phases of type '{}' is not supported.", other.type());
+    }
+    thermo.setName(other.name());
+    for (size_t m = 0; m < other.nElements(); m++) {
+        thermo.addElement(other.elementName(m), other.atomicWeight(m),
+                          other.atomicNumber(m), other.entropyElement298(m),
+                          other.elementType(m));
+    }
+    for (size_t k = 0; k < other.nSpecies(); k++) {
+        thermo.addSpecies(copySpecies(*other.species(k)));
+    }
+    installPDSS(thermo);
+    thermo.setParameters(other.input());
+    thermo.initThermo();
+
+    vector<double> state;
+    other.saveState(state);
+    thermo.restoreState(state);
+}
+
 }
@@ -0,0 +1,84 @@
+/**
+ *  @file ApproxMixTransport.cpp
+ *  Approximate mixture-averaged transport properties for ideal gas mixtures.
+ */
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/transport/ApproxMixTransport.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+double ApproxMixTransport::viscosity()
+{
+    update_T();
+    update_C();
+
+    if (m_visc_ok) {
+        return m_viscmix;
+    }
+    if (!m_spvisc_ok) {
+        updateSpeciesViscosities();
+    }
+
+    // find the dominant species, always including the most abundant one
+    m_dominant.clear();
+    size_t kmax = 0;
+    double xDominant = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (m_molefracs[k] >= m_threshold) {
+            m_dominant.push_back(k);
+            xDominant += m_molefracs[k];
+        }
+        if (m_molefracs[k] > m_molefracs[kmax]) {
+            kmax = k;
+        }
+    }
+    if (m_dominant.empty()) {
+        m_dominant.push_back(kmax);
+        xDominant = m_molefracs[kmax];
+    }
+
+    // remaining species are lumped with a weighting factor of one
+    double xOther = std::max(1.0 - xDominant, 0.0);
+    double vismix = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        double denom = xOther;
+        for (size_t j : m_dominant) {
+            denom += m_molefracs[j] * wilkeWeight(k, j);
+        }
+        vismix += m_molefracs[k] * m_visc[k] / denom;
+    }
+    m_viscmix = vismix;
+    return vismix;
+}
+
+void ApproxMixTransport::setDominantSpeciesThreshold(double threshold)
+{
+    if (threshold < 0.0 || threshold > 1.0) {
+        throw CanteraError("ApproxMixTransport::setDominantSpeciesThreshold",
+            "Threshold must be between 0 and 1; got {}", threshold);
+    }
+    m_threshold = threshold;
+    m_visc_ok = false;
+}
+
+double ApproxMixTransport::wilkeWeight(size_t k, size_t j) const
+{
+    // Evaluated in the same way as the full matrix in updateViscosity_T(), where
+    // only the lower triangle is computed directly.
+    // Note that m_wratjk(k,j) holds the square root of m_wratjk(j,k)!
+    if (k >= j) {
+        double factor1 = 1.0 + (m_sqvisc[k]/m_sqvisc[j]) * m_wratjk(k,j);
+        return factor1*factor1 / (sqrt(8.0) * m_wratkj1(j,k));
+    } else {
+        double factor1 = 1.0 + (m_sqvisc[j]/m_sqvisc[k]) * m_wratjk(j,k);
+        double phi_jk = factor1*factor1 / (sqrt(8.0) * m_wratkj1(k,j));
+        return phi_jk / ((m_visc[j]/m_visc[k]) * (m_mw[k]/m_mw[j]));
+    }
+}
+
+}
@@ -105,15 +105,16 @@ void GasTransport::updateViscosity_T()
 void GasTransport::updateSpeciesViscosities()
 {
     update_T();
+    evalPolynomialFits(m_visccoeffs, 0, m_nsp, m_sqvisc.data());
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_visc[k] = exp(dot4(m_polytempvec, m_visccoeffs[k]));
+            m_visc[k] = exp(m_sqvisc[k]);
             m_sqvisc[k] = sqrt(m_visc[k]);
         }
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
             // the polynomial fit is done for sqrt(visc/sqrt(T))
-            m_sqvisc[k] = m_t14 * dot5(m_polytempvec, m_visccoeffs[k]);
+            m_sqvisc[k] *= m_t14;
             m_visc[k] = (m_sqvisc[k] * m_sqvisc[k]);
         }
     }
@@ -123,29 +124,57 @@ void GasTransport::updateSpeciesViscosities()
 void GasTransport::updateDiff_T()
 {
     update_T();
-    // evaluate binary diffusion coefficients at unit pressure
+    // evaluate binary diffusion coefficients at unit pressure. The fits for the
+    // pairs (i, j >= i) are stored contiguously, and are evaluated directly into
+    // the corresponding (contiguous) part of column i of m_bdiff.
     size_t ic = 0;
-    if (m_mode == CK_Mode) {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = exp(dot4(m_polytempvec, m_diffcoeffs[ic]));
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
+    for (size_t i = 0; i < m_nsp; i++) {
+        size_t n = m_nsp - i;
+        double* bdiff = m_bdiff.ptrColumn(i) + i;
+        evalPolynomialFits(m_diffcoeffs, ic, n, bdiff);
+        if (m_mode == CK_Mode) {
+            for (size_t j = 0; j < n; j++) {
+                bdiff[j] = exp(bdiff[j]);
             }
-        }
-    } else {
-        for (size_t i = 0; i < m_nsp; i++) {
-            for (size_t j = i; j < m_nsp; j++) {
-                m_bdiff(i,j) = m_temp * m_sqrt_t*dot5(m_polytempvec,
-                                                      m_diffcoeffs[ic]);
-                m_bdiff(j,i) = m_bdiff(i,j);
-                ic++;
+        } else {
+            double pre = m_temp * m_sqrt_t;
+            for (size_t j = 0; j < n; j++) {
+                bdiff[j] *= pre;
             }
         }
+        ic += n;
+    }
+    for (size_t i = 0; i < m_nsp; i++) {
+        for (size_t j = i + 1; j < m_nsp; j++) {
+            m_bdiff(i,j) = m_bdiff(j,i);
+        }
     }
     m_bindiff_ok = true;
 }
 
+void GasTransport::evalPolynomialFits(const Array2D& coeffs, size_t start, size_t n,
+                                      double* out) const
+{
+    // Loops run over the fits, with each coefficient read from a contiguous column,
+    // so that the compiler can vectorize them.
+    const double* p = m_polytempvec.data();
+    const double* c0 = coeffs.ptrColumn(0) + start;
+    const double* c1 = coeffs.ptrColumn(1) + start;
+    const double* c2 = coeffs.ptrColumn(2) + start;
+    const double* c3 = coeffs.ptrColumn(3) + start;
+    if (m_mode == CK_Mode) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = p[0] * c0[i] + p[1] * c1[i] + p[2] * c2[i] + p[3] * c3[i];
+        }
+    } else {
+        const double* c4 = coeffs.ptrColumn(4) + start;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = p[0] * c0[i] + p[1] * c1[i] + p[2] * c2[i] + p[3] * c3[i]
+                     + p[4] * c4[i];
+        }
+    }
+}
+
 void GasTransport::getBinaryDiffCoeffs(const size_t ld, double* const d)
 {
     update_T();
@@ -500,8 +529,8 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
     vector<double> tlog(np), spvisc(np), spcond(np);
     vector<double> w(np), w2(np);
 
-    m_visccoeffs.clear();
-    m_condcoeffs.clear();
+    m_visccoeffs.resize(m_nsp, degree + 1);
+    m_condcoeffs.resize(m_nsp, degree + 1);
 
     // generate array of log(t) values
     for (size_t n = 0; n < np; n++) {
@@ -618,8 +647,8 @@ void GasTransport::fitProperties(MMCollisionInt& integrals)
             mxerr_cond = std::max(mxerr_cond, fabs(err));
             mxrelerr_cond = std::max(mxrelerr_cond, fabs(relerr));
         }
-        m_visccoeffs.push_back(c);
-        m_condcoeffs.push_back(c2);
+        m_visccoeffs.setRow(k, c.data());
+        m_condcoeffs.setRow(k, c2.data());
         m_fittingErrors["conductivity-max-abs-error"] = mxerr_cond;
         m_fittingErrors["conductivity-max-rel-error"] = mxrelerr_cond;
     }
@@ -647,7 +676,8 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
     double err, relerr, mxerr = 0.0, mxrelerr = 0.0;
 
     vector<double> diff(np + 1);
-    m_diffcoeffs.clear();
+    m_diffcoeffs.resize(m_nsp * (m_nsp + 1) / 2, degree + 1);
+    size_t ic = 0;
     for (size_t k = 0; k < m_nsp; k++) {
         for (size_t j = k; j < m_nsp; j++) {
             for (size_t n = 0; n < np; n++) {
@@ -690,7 +720,7 @@ void GasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
                 mxerr = std::max(mxerr, fabs(err));
                 mxrelerr = std::max(mxrelerr, fabs(relerr));
             }
-            m_diffcoeffs.push_back(c);
+            m_diffcoeffs.setRow(ic++, c.data());
         }
     }
 
@@ -754,7 +784,7 @@ void GasTransport::getViscosityPolynomial(size_t i, double* coeffs) const
 {
     checkSpeciesIndex(i);
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        coeffs[k] = m_visccoeffs[i][k];
+        coeffs[k] = m_visccoeffs(i,k);
     }
 }
 
@@ -762,7 +792,7 @@ void GasTransport::getConductivityPolynomial(size_t i, double* coeffs) const
 {
     checkSpeciesIndex(i);
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        coeffs[k] = m_condcoeffs[i][k];
+        coeffs[k] = m_condcoeffs(i,k);
     }
 }
 
@@ -779,7 +809,7 @@ void GasTransport::getBinDiffusivityPolynomial(size_t i, size_t j, double* coeff
     ic += mj - mi;
 
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        coeffs[k] = m_diffcoeffs[ic][k];
+        coeffs[k] = m_diffcoeffs(ic,k);
     }
 }
 
@@ -801,7 +831,7 @@ void GasTransport::setViscosityPolynomial(size_t i, double* coeffs)
 {
     checkSpeciesIndex(i);
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        m_visccoeffs[i][k] = coeffs[k];
+        m_visccoeffs(i,k) = coeffs[k];
     }
     invalidateCache();
 }
@@ -810,7 +840,7 @@ void GasTransport::setConductivityPolynomial(size_t i, double* coeffs)
 {
     checkSpeciesIndex(i);
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        m_condcoeffs[i][k] = coeffs[k];
+        m_condcoeffs(i,k) = coeffs[k];
     }
     invalidateCache();
 }
@@ -828,7 +858,7 @@ void GasTransport::setBinDiffusivityPolynomial(size_t i, size_t j, double* coeff
     ic += mj - mi;
 
     for (int k = 0; k < (m_mode == CK_Mode ? 4 : 5); k++) {
-        m_diffcoeffs[ic][k] = coeffs[k];
+        m_diffcoeffs(ic,k) = coeffs[k];
     }
     invalidateCache();
 }
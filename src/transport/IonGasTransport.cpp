@@ -227,7 +227,7 @@ void IonGasTransport::fitDiffCoeffs(MMCollisionInt& integrals)
                 mxrelerr = std::max(mxrelerr, fabs(relerr));
             }
             size_t sum = k * (k + 1) / 2;
-            m_diffcoeffs[k*m_nsp+j-sum] = c;
+            m_diffcoeffs.setRow(k*m_nsp+j-sum, c.data());
         }
     }
     m_fittingErrors["diff-coeff-max-abs-error"] =
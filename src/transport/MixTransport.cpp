@@ -109,13 +109,14 @@ void MixTransport::update_C()
 
 void MixTransport::updateCond_T()
 {
+    evalPolynomialFits(m_condcoeffs, 0, m_nsp, m_cond.data());
     if (m_mode == CK_Mode) {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = exp(dot4(m_polytempvec, m_condcoeffs[k]));
+            m_cond[k] = exp(m_cond[k]);
         }
     } else {
         for (size_t k = 0; k < m_nsp; k++) {
-            m_cond[k] = m_sqrt_t * dot5(m_polytempvec, m_condcoeffs[k]);
+            m_cond[k] *= m_sqrt_t;
         }
     }
     m_spcond_ok = true;
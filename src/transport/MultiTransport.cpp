@@ -32,6 +32,82 @@ double Frot(double tr, double sqtr)
     return 1.0 + c1*sqtr + c2*tr + c3*sqtr*tr;
 }
 
+/**
+ * Solve `A x = b` for a symmetric positive semi-definite matrix `A` using the
+ * conjugate gradient method with a diagonal preconditioner.
+ *
+ * @param n  Size of the system
+ * @param A  Function evaluating the matrix-vector product `A(p, Ap)`
+ * @param diag  Positive preconditioner, usually the diagonal of `A`
+ * @param b  Right-hand side, which must be in the range of `A`
+ * @param x  On input, the initial guess; on output, the solution
+ * @param rtol  Relative tolerance on the residual norm
+ * @param maxIter  Maximum number of iterations
+ * @returns  The number of iterations, or `npos` if the iteration did not converge
+ */
+template <class MatVec>
+size_t pcgSolve(size_t n, const MatVec& A, const double* diag, const double* b,
+                double* x, double rtol, size_t maxIter)
+{
+    vector<double> r(n), z(n), p(n), Ap(n);
+    double bnorm = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        bnorm += b[i] * b[i];
+    }
+    if (bnorm == 0.0) {
+        std::fill(x, x + n, 0.0);
+        return 0;
+    }
+    A(x, Ap.data());
+    double rr = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        r[i] = b[i] - Ap[i];
+        rr += r[i] * r[i];
+    }
+    if (rr > bnorm) {
+        // initial guess is worse than the zero vector
+        std::fill(x, x + n, 0.0);
+        std::copy(b, b + n, r.begin());
+        rr = bnorm;
+    }
+    double rz = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        z[i] = r[i] / diag[i];
+        p[i] = z[i];
+        rz += r[i] * z[i];
+    }
+    double tol2 = rtol * rtol * bnorm;
+    for (size_t iter = 0; iter < maxIter; iter++) {
+        if (rr <= tol2) {
+            return iter;
+        }
+        A(p.data(), Ap.data());
+        double pAp = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            pAp += p[i] * Ap[i];
+        }
+        if (!(pAp > 0.0)) {
+            return npos;
+        }
+        double alpha = rz / pAp;
+        double rzNew = 0.0;
+        rr = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * Ap[i];
+            z[i] = r[i] / diag[i];
+            rzNew += r[i] * z[i];
+            rr += r[i] * r[i];
+        }
+        double beta = rzNew / rz;
+        rz = rzNew;
+        for (size_t i = 0; i < n; i++) {
+            p[i] = z[i] + beta * p[i];
+        }
+    }
+    return (rr <= tol2) ? maxIter : npos;
+}
+
 //////////////////// class MultiTransport methods //////////////
 
 void MultiTransport::init(ThermoPhase* thermo, int mode)
@@ -81,6 +157,17 @@ void MultiTransport::init(ThermoPhase* thermo, int mode)
     }
 }
 
+void MultiTransport::setIterativeSolver(bool iterative, double rtol)
+{
+    if (rtol <= 0.0) {
+        throw CanteraError("MultiTransport::setIterativeSolver",
+            "Relative tolerance must be positive; got {}", rtol);
+    }
+    m_iterative = iterative;
+    m_iterativeRtol = rtol;
+    m_lmatrix_soln_ok = false;
+}
+
 void MultiTransport::invalidateCache()
 {
     GasTransport::invalidateCache();
@@ -150,6 +237,17 @@ void MultiTransport::solveLMatrixEquation()
     // evaluate the submatrices of the L matrix
     m_Lmatrix.resize(3*m_nsp, 3*m_nsp, 0.0);
 
+    if (m_iterative) {
+        solveLMatrixIterative();
+        if (m_lmatrix_soln_ok) {
+            m_molefracs_last = m_molefracs;
+            // L00,00 block does not contain the original L matrix entries
+            m_l0000_ok = false;
+            return;
+        }
+        // otherwise, fall back to the direct solver
+    }
+
     //! Evaluate the upper-left block of the L matrix.
     eval_L0000(m_molefracs.data());
     eval_L0010(m_molefracs.data());
@@ -171,6 +269,159 @@ void MultiTransport::solveLMatrixEquation()
     m_l0000_ok = false;
 }
 
+void MultiTransport::solveLMatrixIterative()
+{
+    // The off-diagonal entries of L00,00 are the sum of a symmetric part and a
+    // rank-one part. With the first block of the right-hand side being zero, the
+    // rank-one part only imposes the constraint sum_j(X_j M_j a_j) = 0 on the
+    // first block of the solution. Replacing L00,00 with its symmetric part (whose
+    // rows sum to zero) therefore makes the L matrix symmetric, and the constraint
+    // is imposed after solving the system. The L matrix is negative semi-definite,
+    // so the conjugate gradient method is applied to -L.
+    const double* x = m_molefracs.data();
+    double prefactor = 16.0*m_temp/25.0;
+    for (size_t i = 0; i < m_nsp; i++) {
+        double sum = 0.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (j != i) {
+                m_Lmatrix(i,j) = prefactor * x[i] * x[j] / m_bdiff(i,j);
+                sum += m_Lmatrix(i,j);
+            }
+        }
+        m_Lmatrix(i,i) = -sum;
+    }
+    eval_L0010(x);
+    eval_L0001();
+    eval_L1000();
+    eval_L1010(x);
+    eval_L1001(x);
+    eval_L0100();
+    eval_L0110();
+    eval_L0101(x);
+    // The equations for species without internal modes are a[2*m_nsp + k] = 0
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (!hasInternalModes(k)) {
+            m_Lmatrix(2*m_nsp + k, 2*m_nsp + k) = -1.0;
+        }
+    }
+
+    size_t n = 3*m_nsp;
+    vector<double> diag(n), rhs(n);
+    for (size_t i = 0; i < n; i++) {
+        diag[i] = -m_Lmatrix(i,i);
+        if (!(diag[i] > 0.0)) {
+            return;
+        }
+        rhs[i] = -m_b[i];
+    }
+    auto negL = [this, n](const double* p, double* Lp) {
+        multiply(m_Lmatrix, p, Lp);
+        for (size_t i = 0; i < n; i++) {
+            Lp[i] = -Lp[i];
+        }
+    };
+    // The previous solution in m_a is used as the initial guess
+    size_t iters = pcgSolve(n, negL, diag.data(), rhs.data(), m_a.data(),
+                            m_iterativeRtol, 2*n + 10);
+    if (iters == npos) {
+        return;
+    }
+    m_lastIterations = iters;
+
+    // impose the constraint on the first block of the solution
+    double sum = 0.0, sumw = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        sum += x[k] * m_mw[k] * m_a[k];
+        sumw += x[k] * m_mw[k];
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_a[k] -= sum / sumw;
+    }
+    m_lmatrix_soln_ok = true;
+}
+
+void MultiTransport::getStefanMaxwellSystem(size_t ld, double* S, double* v)
+{
+    update_T();
+    update_C();
+    if (!m_bindiff_ok) {
+        updateDiff_T();
+    }
+    double sum = 0.0;
+    for (size_t j = 0; j < m_nsp; j++) {
+        sum += m_molefracs[j] * m_mw[j];
+    }
+    for (size_t j = 0; j < m_nsp; j++) {
+        v[j] = m_molefracs[j] * m_mw[j] / sum;
+        for (size_t i = 0; i < m_nsp; i++) {
+            S[ld*j + i] = (i == j) ? 0.0
+                : m_molefracs[i] * m_molefracs[j] / m_bdiff(i,j);
+        }
+    }
+}
+
+size_t MultiTransport::solveStefanMaxwell(size_t n, const double* S, size_t ld,
+                                          const double* v, const double* b,
+                                          double* z, double rtol)
+{
+    // The equations are written as A z = -b, where A = diag(S 1) - S (excluding
+    // the diagonal of S) is symmetric positive semi-definite, with the vector of
+    // ones spanning its null space.
+    vector<double> diag(n, 0.0), rhs(n);
+    double mean = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        mean += b[i] / n;
+    }
+    for (size_t j = 0; j < n; j++) {
+        rhs[j] = mean - b[j];
+        const double* Sj = S + ld*j;
+        for (size_t i = 0; i < j; i++) {
+            diag[i] += Sj[i];
+        }
+        for (size_t i = j + 1; i < n; i++) {
+            diag[i] += Sj[i];
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (!(diag[i] > 0.0)) {
+            diag[i] = 1.0;
+        }
+    }
+    auto A = [&](const double* p, double* Ap) {
+        for (size_t i = 0; i < n; i++) {
+            Ap[i] = 0.0;
+        }
+        for (size_t j = 0; j < n; j++) {
+            const double* Sj = S + ld*j;
+            double pj = p[j];
+            for (size_t i = 0; i < j; i++) {
+                Ap[i] += Sj[i] * (p[i] - pj);
+            }
+            for (size_t i = j + 1; i < n; i++) {
+                Ap[i] += Sj[i] * (p[i] - pj);
+            }
+        }
+    };
+    size_t maxIter = 2*n + 10;
+    size_t iters = pcgSolve(n, A, diag.data(), rhs.data(), z, rtol, maxIter);
+    if (iters == npos) {
+        throw CanteraError("MultiTransport::solveStefanMaxwell",
+            "Conjugate gradient iteration did not converge in {} iterations.",
+            maxIter);
+    }
+
+    // select the solution satisfying the constraint
+    double sum = 0.0, sumw = 0.0;
+    for (size_t k = 0; k < n; k++) {
+        sum += v[k] * z[k];
+        sumw += v[k];
+    }
+    for (size_t k = 0; k < n; k++) {
+        z[k] -= sum / sumw;
+    }
+    return iters;
+}
+
 void MultiTransport::getSpeciesFluxes(size_t ndim, const double* const grad_T,
                                       size_t ldx, const double* const grad_X,
                                       size_t ldf, double* const fluxes)
@@ -193,6 +444,27 @@ void MultiTransport::getSpeciesFluxes(size_t ndim, const double* const grad_T,
 
     const double* y = m_thermo->massFractions();
     double rho = m_thermo->density();
+    double pp = pressure_ig();
+
+    if (m_iterative) {
+        getStefanMaxwellSystem(m_nsp, m_aa.ptrColumn(0), m_spwork1.data());
+        for (size_t n = 0; n < ndim; n++) {
+            double* V = fluxes + ldf*n;
+            std::fill(V, V + m_nsp, 0.0);
+            m_lastIterations = solveStefanMaxwell(m_nsp, m_aa.ptrColumn(0), m_nsp,
+                m_spwork1.data(), grad_X + ldx*n, V, m_iterativeRtol);
+            for (size_t i = 0; i < m_nsp; i++) {
+                V[i] *= rho * m_spwork1[i] / pp;
+            }
+            if (addThermalDiffusion) {
+                double grad_logt = grad_T[n]/m_temp;
+                for (size_t i = 0; i < m_nsp; i++) {
+                    V[i] -= m_spwork[i]*grad_logt;
+                }
+            }
+        }
+        return;
+    }
 
     for (size_t i = 0; i < m_nsp; i++) {
         double sum = 0.0;
@@ -234,7 +506,6 @@ void MultiTransport::getSpeciesFluxes(size_t ndim, const double* const grad_T,
 
     // solve the equations
     solve(m_aa, fluxes, ndim, ldf);
-    double pp = pressure_ig();
 
     // multiply diffusion velocities by rho * V to create mass fluxes, and
     // restore the gradx elements that were modified
@@ -297,43 +568,58 @@ void MultiTransport::getMassFluxes(const double* state1, const double* state2,
 
     const double* y = m_thermo->massFractions();
     double rho = m_thermo->density();
-    for (size_t i = 0; i < m_nsp; i++) {
-        double sum = 0.0;
+    double pp = pressure_ig();
+
+    // mass fractions used to convert diffusion velocities to mass fluxes
+    const double* w = y;
+    if (m_iterative) {
+        // x1 is overwritten by the mole fraction gradient
         for (size_t j = 0; j < m_nsp; j++) {
-            m_aa(i,j) = m_molefracs[j]*m_molefracs[i]/m_bdiff(i,j);
-            sum += m_aa(i,j);
+            x1[j] = (x2[j] - x1[j]) / delta;
+            fluxes[j] = 0.0;
+        }
+        getStefanMaxwellSystem(m_nsp, m_aa.ptrColumn(0), x3);
+        m_lastIterations = solveStefanMaxwell(m_nsp, m_aa.ptrColumn(0), m_nsp, x3,
+                                              x1, fluxes, m_iterativeRtol);
+        w = x3;
+    } else {
+        for (size_t i = 0; i < m_nsp; i++) {
+            double sum = 0.0;
+            for (size_t j = 0; j < m_nsp; j++) {
+                m_aa(i,j) = m_molefracs[j]*m_molefracs[i]/m_bdiff(i,j);
+                sum += m_aa(i,j);
+            }
+            m_aa(i,i) -= sum;
         }
-        m_aa(i,i) -= sum;
-    }
 
-    // enforce the condition \sum Y_k V_k = 0. This is done by replacing the
-    // flux equation with the largest gradx component with the flux balance
-    // condition.
-    size_t jmax = 0;
-    double gradmax = -1.0;
-    for (size_t j = 0; j < m_nsp; j++) {
-        if (fabs(x2[j] - x1[j]) > gradmax) {
-            gradmax = fabs(x1[j] - x2[j]) / delta;
-            jmax = j;
+        // enforce the condition \sum Y_k V_k = 0. This is done by replacing the
+        // flux equation with the largest gradx component with the flux balance
+        // condition.
+        size_t jmax = 0;
+        double gradmax = -1.0;
+        for (size_t j = 0; j < m_nsp; j++) {
+            if (fabs(x2[j] - x1[j]) > gradmax) {
+                gradmax = fabs(x1[j] - x2[j]) / delta;
+                jmax = j;
+            }
         }
-    }
 
-    // set the matrix elements in this row to the mass fractions,
-    // and set the entry in gradx to zero
-    for (size_t j = 0; j < m_nsp; j++) {
-        m_aa(jmax,j) = y[j];
-        fluxes[j] = (x2[j] - x1[j]) / delta;
-    }
-    fluxes[jmax] = 0.0;
+        // set the matrix elements in this row to the mass fractions,
+        // and set the entry in gradx to zero
+        for (size_t j = 0; j < m_nsp; j++) {
+            m_aa(jmax,j) = y[j];
+            fluxes[j] = (x2[j] - x1[j]) / delta;
+        }
+        fluxes[jmax] = 0.0;
 
-    // Solve the equations
-    solve(m_aa, fluxes);
+        // Solve the equations
+        solve(m_aa, fluxes);
+    }
 
-    double pp = pressure_ig();
     // multiply diffusion velocities by rho * Y_k to create
     // mass fluxes, and divide by pressure
     for (size_t i = 0; i < m_nsp; i++) {
-        fluxes[i] *= rho * y[i] / pp;
+        fluxes[i] *= rho * w[i] / pp;
     }
 
     // thermal diffusion
@@ -9,6 +9,7 @@
 #include "cantera/transport/Transport.h"
 #include "cantera/base/AnyMap.h"
 #include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoPhase.h"
 
 namespace Cantera
 {
@@ -27,6 +28,20 @@ void Transport::checkSpeciesArraySize(size_t kk) const
     }
 }
 
+shared_ptr<Transport> Transport::clone(shared_ptr<ThermoPhase> thermo) const
+{
+    return newTransport(thermo, transportModel());
+}
+
+void Transport::checkClone(const ThermoPhase& thermo) const
+{
+    if (thermo.nSpecies() != m_nsp) {
+        throw CanteraError("Transport::clone", "Phase '{}' has {} species, but the "
+            "'{}' transport model was set up for {} species.", thermo.name(),
+            thermo.nSpecies(), transportModel(), m_nsp);
+    }
+}
+
 AnyMap Transport::parameters() const
 {
     AnyMap out;
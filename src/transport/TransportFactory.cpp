@@ -6,6 +6,7 @@
 // known transport models
 #include "cantera/transport/MultiTransport.h"
 #include "cantera/transport/MixTransport.h"
+#include "cantera/transport/ApproxMixTransport.h"
 #include "cantera/transport/UnityLewisTransport.h"
 #include "cantera/transport/IonGasTransport.h"
 #include "cantera/transport/WaterTransport.h"
@@ -36,10 +37,19 @@ TransportFactory::TransportFactory()
     addDeprecatedAlias("mixture-averaged", "Mix");
     reg("mixture-averaged-CK", []() { return new MixTransport(); });
     addDeprecatedAlias("mixture-averaged-CK", "CK_Mix");
+    reg("mixture-averaged-approximate", []() { return new ApproxMixTransport(); });
+    reg("mixture-averaged-approximate-CK", []() { return new ApproxMixTransport(); });
     reg("multicomponent", []() { return new MultiTransport(); });
     addDeprecatedAlias("multicomponent", "Multi");
     reg("multicomponent-CK", []() { return new MultiTransport(); });
     addDeprecatedAlias("multicomponent-CK", "CK_Multi");
+    auto iterativeMulti = []() {
+        auto tr = new MultiTransport();
+        tr->setIterativeSolver(true);
+        return tr;
+    };
+    reg("multicomponent-iterative", iterativeMulti);
+    reg("multicomponent-iterative-CK", iterativeMulti);
     reg("ionized-gas", []() { return new IonGasTransport(); });
     addDeprecatedAlias("ionized-gas", "Ion");
     reg("water", []() { return new WaterTransport(); });
@@ -48,7 +58,9 @@ TransportFactory::TransportFactory()
     addDeprecatedAlias("high-pressure", "HighP");
     reg("high-pressure-Chung", []() { return new ChungHighPressureGasTransport(); });
     m_CK_mode["CK_Mix"] = m_CK_mode["mixture-averaged-CK"] = true;
+    m_CK_mode["mixture-averaged-approximate-CK"] = true;
     m_CK_mode["CK_Multi"] = m_CK_mode["multicomponent-CK"] = true;
+    m_CK_mode["multicomponent-iterative-CK"] = true;
 }
 
 TransportFactory* TransportFactory::factory() {
@@ -90,7 +102,10 @@ Transport* TransportFactory::newTransport(const string& transportModel,
         dtr->initialize(phase, gastr);
     } else {
         tr = create(transportModel);
-        int mode = m_CK_mode[transportModel] ? CK_Mode : 0;
+        // Use find() rather than operator[], which may modify the map and
+        // prevents concurrent calls from different threads
+        auto iter = m_CK_mode.find(transportModel);
+        int mode = (iter != m_CK_mode.end() && iter->second) ? CK_Mode : 0;
         tr->init(phase, mode);
     }
     phase->restoreState(state);
@@ -0,0 +1,152 @@
+//! @file ReactorEnsemble.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/base/Solution.h"
+#include "cantera/base/SolutionArray.h"
+#include "cantera/base/ThreadPool.h"
+#include "cantera/thermo/ThermoPhase.h"
+
+#include <atomic>
+
+namespace Cantera
+{
+
+ReactorEnsemble::ReactorEnsemble(const string& infile, const string& name,
+                                 const string& reactorType)
+    : m_infile(infile)
+    , m_phaseName(name)
+    , m_reactorType(reactorType)
+{
+    updateWorkers();
+}
+
+ReactorEnsemble::~ReactorEnsemble() = default;
+
+void ReactorEnsemble::setNumThreads(size_t nThreads)
+{
+    m_pool.reset();
+    if (nThreads != 1) {
+        m_pool = make_unique<ThreadPool>(nThreads);
+        if (m_pool->size() == 1) {
+            m_pool.reset();
+        }
+    }
+    updateWorkers();
+}
+
+size_t ReactorEnsemble::numThreads() const
+{
+    return m_pool ? m_pool->size() : 1;
+}
+
+void ReactorEnsemble::setTolerances(double rtol, double atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+    for (auto& worker : m_workers) {
+        worker.net->setTolerances(m_rtol, m_atol);
+    }
+}
+
+void ReactorEnsemble::updateWorkers()
+{
+    // The input file is only parsed once, since AnyMap caches the parsed contents
+    while (m_workers.size() < numThreads()) {
+        Worker worker;
+        worker.solution = newSolution(m_infile, m_phaseName, "none");
+        worker.reactor = newReactor4(m_reactorType, worker.solution);
+        worker.net = make_shared<ReactorNet>(worker.reactor);
+        worker.net->setTolerances(m_rtol, m_atol);
+        m_workers.push_back(worker);
+    }
+}
+
+shared_ptr<SolutionArray> ReactorEnsemble::integrate(SolutionArray& initial)
+{
+    updateWorkers();
+    size_t nCases = static_cast<size_t>(initial.size());
+
+    // Extract the initial states serially, since accessing the SolutionArray
+    // modifies the state of its Solution
+    vector<vector<double>> states(nCases);
+    for (size_t i = 0; i < nCases; i++) {
+        states[i] = initial.getState(static_cast<int>(i));
+    }
+    vector<double> tIgnition(nCases, NAN);
+    vector<AnyMap> stats(nCases);
+
+    // Each thread takes the next unprocessed case until all cases are done
+    std::atomic<size_t> next{0};
+    auto work = [&](size_t thread) {
+        Worker& worker = m_workers[thread];
+        ThermoPhase& thermo = *worker.solution->thermo();
+        ReactorNet& net = *worker.net;
+        for (size_t i = next++; i < nCases; i = next++) {
+            // Reset the volume, which changes during integration for some reactor
+            // types, so that results are independent of previously computed cases
+            thermo.restoreState(states[i]);
+            worker.reactor->setInitialVolume(1.0);
+            worker.reactor->syncState();
+            net.setInitialTime(0.0);
+
+            // Take individual steps until ignition to resolve the ignition time
+            double tPrev = 0.0;
+            double TPrev = worker.reactor->temperature();
+            double TIgnition = TPrev + m_deltaT;
+            while (net.time() < m_tEnd) {
+                double t = net.step();
+                double T = worker.reactor->temperature();
+                if (T > TIgnition) {
+                    tIgnition[i] = tPrev + (TIgnition - TPrev) / (T - TPrev) * (t - tPrev);
+                    break;
+                }
+                tPrev = t;
+                TPrev = T;
+            }
+            // Continue to (or interpolate back to) the end time
+            net.advance(m_tEnd);
+            thermo.saveState(states[i]);
+            stats[i] = net.solverStats();
+        }
+    };
+    if (m_pool) {
+        m_pool->parallelFor(m_pool->size(), [&](size_t i, size_t thread) {
+            work(thread);
+        });
+    } else {
+        work(0);
+    }
+
+    // Assemble results in columnar form
+    auto out = SolutionArray::create(initial.solution(), static_cast<int>(nCases));
+    for (size_t i = 0; i < nCases; i++) {
+        out->setState(static_cast<int>(i), states[i]);
+    }
+    AnyValue column;
+    column = tIgnition;
+    out->addExtra("ignition-delay");
+    out->setComponent("ignition-delay", column);
+    std::map<string, vector<long int>> counters;
+    for (size_t i = 0; i < nCases; i++) {
+        for (const auto& [key, value] : stats[i]) {
+            if (value.is<long int>()) {
+                auto& column = counters[key];
+                column.resize(nCases, 0);
+                column[i] = value.asInt();
+            }
+        }
+    }
+    for (auto& [key, values] : counters) {
+        column = values;
+        out->addExtra(key);
+        out->setComponent(key, column);
+    }
+    return out;
+}
+
+}
@@ -0,0 +1,326 @@
+//! @file ReactorISAT.cpp
+
+// This file is part of Cantera. See License.txt in the top-level directory or
+// at https://cantera.org/license.txt for license and copyright information.
+
+#include "cantera/zeroD/ReactorISAT.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/ReactorFactory.h"
+#include "cantera/base/Solution.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/numerics/eigen_dense.h"
+#include "cantera/numerics/eigen_sparse.h"
+
+namespace Cantera
+{
+
+//! A tabulated initial state and its linearized reaction mapping
+struct ReactorISAT::Record
+{
+    Eigen::VectorXd phi; //!< Scaled initial state and time step
+    Eigen::VectorXd mapped; //!< Scaled mapped state
+    Eigen::MatrixXd gradient; //!< Scaled mapping gradient
+    Eigen::MatrixXd eoa; //!< Ellipsoid of accuracy, `{x : x^T eoa x <= 1}`
+    Node* leaf = nullptr; //!< Leaf of the binary tree containing this record
+    std::list<Record*>::iterator lru; //!< Position in the list of used records
+};
+
+//! Node of the binary tree. Leaves hold a record; other nodes hold a cutting plane
+//! and always have two children.
+struct ReactorISAT::Node
+{
+    Node* parent = nullptr;
+    unique_ptr<Node> left; //!< Child for points with `normal . phi <= offset`
+    unique_ptr<Node> right; //!< Child for points with `normal . phi > offset`
+    Eigen::VectorXd normal; //!< Normal vector of the cutting plane
+    double offset = 0.0; //!< Offset of the cutting plane
+    unique_ptr<Record> record; //!< Record stored in a leaf
+};
+
+ReactorISAT::ReactorISAT(shared_ptr<Solution> sol)
+    : m_solution(sol)
+{
+    m_reactor = newReactor4("IdealGasConstPressureMoleReactor", sol);
+    m_net = make_shared<ReactorNet>(m_reactor);
+    m_nsp = sol->thermo()->nSpecies();
+    m_nin = m_nsp + 2;
+}
+
+ReactorISAT::~ReactorISAT() = default;
+
+void ReactorISAT::setTolerance(double tol)
+{
+    if (tol <= 0.0) {
+        throw CanteraError("ReactorISAT::setTolerance",
+                           "Tolerance must be positive; got {}", tol);
+    }
+    m_tol = tol;
+    clear();
+}
+
+void ReactorISAT::setTemperatureScale(double T)
+{
+    if (T <= 0.0) {
+        throw CanteraError("ReactorISAT::setTemperatureScale",
+                           "Temperature scale must be positive; got {}", T);
+    }
+    m_Tscale = T;
+    clear();
+}
+
+void ReactorISAT::setMaxRecords(size_t n)
+{
+    if (n == 0) {
+        throw CanteraError("ReactorISAT::setMaxRecords",
+                           "Maximum number of records must be positive.");
+    }
+    m_maxRecords = n;
+    while (nRecords() > m_maxRecords) {
+        evict();
+    }
+}
+
+void ReactorISAT::clear()
+{
+    m_lru.clear();
+    m_root.reset();
+    m_dtScale = 0.0;
+}
+
+AnyMap ReactorISAT::stats() const
+{
+    AnyMap stats;
+    stats["queries"] = m_nQueries;
+    stats["retrieves"] = m_nRetrieves;
+    stats["grows"] = m_nGrows;
+    stats["adds"] = m_nAdds;
+    stats["evictions"] = m_nEvictions;
+    stats["direct-integrations"] = m_nDirect;
+    stats["records"] = static_cast<long int>(nRecords());
+    stats["hit-rate"] = m_nQueries ? double(m_nRetrieves) / m_nQueries : 0.0;
+    return stats;
+}
+
+void ReactorISAT::advance(double dt)
+{
+    if (dt <= 0.0) {
+        throw CanteraError("ReactorISAT::advance",
+                           "Time step must be positive; got {}", dt);
+    }
+    ThermoPhase& thermo = *m_solution->thermo();
+    m_nQueries++;
+    double P = thermo.pressure();
+    if (m_root && std::abs(P - m_pressure) > 1e-12 * m_pressure) {
+        clear();
+    }
+    if (!m_root) {
+        m_pressure = P;
+        m_dtScale = dt;
+    }
+
+    Eigen::VectorXd phi(m_nin), out(m_nsp + 1);
+    phi[0] = thermo.temperature() / m_Tscale;
+    thermo.getMassFractions(phi.data() + 1);
+    phi[m_nsp + 1] = dt / m_dtScale;
+
+    auto setResult = [&]() {
+        thermo.setState_TPY(out[0] * m_Tscale, m_pressure, out.data() + 1);
+    };
+
+    Node* leaf = findLeaf(phi.data());
+    Eigen::VectorXd delta;
+    double r2 = 0.0;
+    if (leaf) {
+        Record& rec = *leaf->record;
+        delta = phi - rec.phi;
+        r2 = delta.dot(rec.eoa * delta);
+        if (r2 <= 1.0) {
+            out = rec.mapped + rec.gradient * delta;
+            m_nRetrieves++;
+            touch(&rec);
+            setResult();
+            return;
+        }
+    }
+
+    // Direct integration, which also provides the sensitivities needed for a new
+    // record in case the EOA of the nearest record cannot be grown
+    auto newRecord = make_unique<Record>();
+    integrate(phi.data(), out.data(), *newRecord);
+    if (leaf) {
+        Record& rec = *leaf->record;
+        Eigen::VectorXd error = out - rec.mapped - rec.gradient * delta;
+        if (error.norm() <= m_tol) {
+            // Grow the EOA to the minimum-volume ellipsoid containing both the
+            // current EOA and the query point
+            Eigen::VectorXd g = rec.eoa * delta;
+            rec.eoa += (1.0 / r2 - 1.0) / r2 * g * g.transpose();
+            m_nGrows++;
+            touch(&rec);
+            setResult();
+            return;
+        }
+    }
+
+    insert(leaf, std::move(newRecord));
+    m_nAdds++;
+    while (nRecords() > m_maxRecords) {
+        evict();
+    }
+    setResult();
+}
+
+void ReactorISAT::integrate(const double* phi, double* out, Record& record)
+{
+    ThermoPhase& thermo = *m_solution->thermo();
+    thermo.setState_TPY(phi[0] * m_Tscale, m_pressure, phi + 1);
+    double dt = phi[m_nsp + 1] * m_dtScale;
+
+    // Integrate one kilogram of gas, for which the state variables of the reactor
+    // (temperature and moles) are related to (T, Y) by a constant scaling
+    m_reactor->setInitialVolume(1.0 / thermo.density());
+    m_reactor->syncState();
+    m_net->setInitialTime(0.0);
+    m_nDirect++;
+
+    size_t n = m_nsp + 1;
+    Eigen::MatrixXd A = Eigen::MatrixXd::Identity(n, n);
+    Eigen::SparseMatrix<double> identity(n, n);
+    identity.setIdentity();
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+    double t = 0.0;
+    while (t < dt) {
+        double tNew = m_net->step();
+        if (tNew > dt) {
+            m_net->advance(dt);
+            tNew = dt;
+        }
+        Eigen::SparseMatrix<double> M = identity - (tNew - t) * m_reactor->jacobian();
+        solver.compute(M);
+        if (solver.info() != Eigen::Success) {
+            throw CanteraError("ReactorISAT::integrate",
+                "Factorization of the step propagator failed at t = {}", tNew);
+        }
+        Eigen::MatrixXd Anew = solver.solve(A);
+        A = Anew;
+        t = tNew;
+    }
+    out[0] = thermo.temperature() / m_Tscale;
+    thermo.getMassFractions(out + 1);
+
+    // Time derivatives at the end of the step, which are the derivatives of the
+    // mapped state with respect to the time step
+    vector<double> wdot(m_nsp), hk(m_nsp);
+    m_solution->kinetics()->getNetProductionRates(wdot.data());
+    thermo.getPartialMolarEnthalpies(hk.data());
+    const vector<double>& mw = thermo.molecularWeights();
+    double rho = thermo.density();
+    Eigen::VectorXd dphi_dt(n);
+    dphi_dt[0] = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        dphi_dt[0] -= hk[k] * wdot[k] / (rho * thermo.cp_mass());
+        dphi_dt[k + 1] = wdot[k] * mw[k] / rho;
+    }
+
+    // Convert the gradient with respect to (T, n_k) to the gradient with respect to
+    // the scaled variables (T/T_s, Y_k, dt/dt_s)
+    vector<double> scale(n); // ratio of scaled variables to reactor state variables
+    scale[0] = 1.0 / m_Tscale;
+    for (size_t k = 0; k < m_nsp; k++) {
+        scale[k + 1] = mw[k];
+    }
+    record.phi = Eigen::Map<const Eigen::VectorXd>(phi, m_nin);
+    record.mapped = Eigen::Map<Eigen::VectorXd>(out, n);
+    record.gradient.resize(n, m_nin);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            record.gradient(i, j) = A(i, j) * scale[i] / scale[j];
+        }
+        record.gradient(i, n) = dphi_dt[i] * m_dtScale * (i ? 1.0 : scale[0]);
+    }
+
+    // The initial EOA is the region where the linear approximation changes the
+    // mapped state by less than the tolerance. Singular values are bounded below
+    // so that the EOA is also bounded in directions where the mapping contracts.
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(record.gradient, Eigen::ComputeFullV);
+    Eigen::VectorXd sigma2 = Eigen::VectorXd::Constant(m_nin, 0.25);
+    const auto& sigma = svd.singularValues();
+    for (Eigen::Index i = 0; i < sigma.size(); i++) {
+        sigma2[i] = std::max(sigma[i] * sigma[i], 0.25);
+    }
+    const Eigen::MatrixXd& V = svd.matrixV();
+    record.eoa = V * sigma2.asDiagonal() * V.transpose() / (m_tol * m_tol);
+}
+
+ReactorISAT::Node* ReactorISAT::findLeaf(const double* phi) const
+{
+    Node* node = m_root.get();
+    if (!node) {
+        return nullptr;
+    }
+    Eigen::Map<const Eigen::VectorXd> x(phi, m_nin);
+    while (!node->record) {
+        node = (node->normal.dot(x) > node->offset) ? node->right.get()
+                                                     : node->left.get();
+    }
+    return node;
+}
+
+void ReactorISAT::insert(Node* leaf, unique_ptr<Record> record)
+{
+    Record* rec = record.get();
+    if (!leaf) {
+        m_root = make_unique<Node>();
+        m_root->record = std::move(record);
+        rec->leaf = m_root.get();
+    } else {
+        // Replace the leaf with a node whose cutting plane is the perpendicular
+        // bisector of the two initial states
+        const Eigen::VectorXd& phiOld = leaf->record->phi;
+        leaf->normal = rec->phi - phiOld;
+        leaf->offset = 0.5 * leaf->normal.dot(rec->phi + phiOld);
+        leaf->left = make_unique<Node>();
+        leaf->left->parent = leaf;
+        leaf->left->record = std::move(leaf->record);
+        leaf->left->record->leaf = leaf->left.get();
+        leaf->right = make_unique<Node>();
+        leaf->right->parent = leaf;
+        leaf->right->record = std::move(record);
+        rec->leaf = leaf->right.get();
+    }
+    m_lru.push_front(rec);
+    rec->lru = m_lru.begin();
+}
+
+void ReactorISAT::evict()
+{
+    Record* rec = m_lru.back();
+    m_lru.pop_back();
+    m_nEvictions++;
+    Node* leaf = rec->leaf;
+    Node* parent = leaf->parent;
+    if (!parent) {
+        m_root.reset();
+        return;
+    }
+    // Replace the parent node with the sibling of the leaf
+    unique_ptr<Node> sibling = (parent->left.get() == leaf) ? std::move(parent->right)
+                                                            : std::move(parent->left);
+    Node* grandparent = parent->parent;
+    sibling->parent = grandparent;
+    if (!grandparent) {
+        m_root = std::move(sibling);
+    } else if (grandparent->left.get() == parent) {
+        grandparent->left = std::move(sibling);
+    } else {
+        grandparent->right = std::move(sibling);
+    }
+}
+
+void ReactorISAT::touch(Record* record)
+{
+    m_lru.splice(m_lru.begin(), m_lru, record->lru);
+}
+
+}
@@ -6,9 +6,11 @@
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/ReactorSurface.h"
+#include "cantera/thermo/SurfPhase.h"
 #include "cantera/zeroD/Wall.h"
 #include "cantera/base/utilities.h"
 #include "cantera/base/Array.h"
+#include "cantera/base/ThreadPool.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/zeroD/FlowReactor.h"
 #include "cantera/numerics/SystemJacobianFactory.h"
@@ -128,6 +130,19 @@ void ReactorNet::initialize()
         }
     }
 
+    // Reactors can be evaluated in parallel only if they don't share phase objects
+    std::set<const ThermoPhase*> phases;
+    size_t nPhases = 0;
+    for (auto reactor : m_reactors) {
+        phases.insert(&reactor->contents());
+        nPhases++;
+        for (size_t i = 0; i < reactor->nSurfs(); i++) {
+            phases.insert(reactor->surface(i)->thermo());
+            nPhases++;
+        }
+    }
+    m_independentReactors = (phases.size() == nPhases);
+
     m_ydot.resize(m_nv,0.0);
     m_yest.resize(m_nv,0.0);
     m_advancelimits.resize(m_nv,-1.0);
@@ -142,6 +157,7 @@ void ReactorNet::initialize()
         m_integ->setPreconditioner(m_precon);
     }
     m_integ->initialize(m_time, *this);
+    m_preconGamma = NAN; // force re-evaluation of the preconditioner Jacobian
     if (m_verbose) {
         writelog("Number of equations: {:d}\n", neq());
         writelog("Maximum time step:   {:14.6g}\n", m_maxstep);
@@ -158,6 +174,7 @@ void ReactorNet::reinitialize()
     if (m_init) {
         debuglog("Re-initializing reactor network.\n", m_verbose);
         m_integ->reinitialize(m_time, *this);
+        m_preconGamma = NAN;
         if (m_integ->preconditionerSide() != PreconditionerSide::NO_PRECONDITION) {
             checkPreconditionerSupported();
         }
@@ -179,6 +196,17 @@ void ReactorNet::setPreconditioner(shared_ptr<SystemJacobian> preconditioner)
     m_integrator_init = false;
 }
 
+void ReactorNet::setPreconditionerReuse(int maxAge, double maxGammaChange)
+{
+    if (maxAge < 0 || maxGammaChange < 0) {
+        throw CanteraError("ReactorNet::setPreconditionerReuse",
+            "Maximum age and maximum change of gamma must be non-negative; "
+            "got {} and {}.", maxAge, maxGammaChange);
+    }
+    m_preconMaxAge = maxAge;
+    m_preconMaxGammaChange = maxGammaChange;
+}
+
 void ReactorNet::setMaxSteps(int nmax)
 {
     integrator().setMaxSteps(nmax);
@@ -449,7 +477,7 @@ void ReactorNet::eval(double t, double* y, double* ydot, double* p)
     updateState(y);
     m_LHS.assign(m_nv, 1);
     m_RHS.assign(m_nv, 0);
-    for (size_t n = 0; n < m_reactors.size(); n++) {
+    forEachReactor([&](size_t n) {
         m_reactors[n]->applySensitivity(p);
         m_reactors[n]->eval(t, m_LHS.data() + m_start[n], m_RHS.data() + m_start[n]);
         size_t yEnd = 0;
@@ -462,7 +490,7 @@ void ReactorNet::eval(double t, double* y, double* ydot, double* p)
             ydot[i] = m_RHS[i] / m_LHS[i];
         }
         m_reactors[n]->resetSensitivity(p);
-    }
+    });
     checkFinite("ydot", ydot, m_nv);
 }
 
@@ -688,10 +716,28 @@ void ReactorNet::preconditionerSolve(double* rhs, double* output)
 
 void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
 {
-    // ensure state is up to date.
-    updateState(y);
     // get the preconditioner
     auto precon = m_integ->preconditioner();
+    // Reuse the previous Jacobian if permitted by the age and gamma-change policy.
+    // A repeated request at the same time indicates that the reused Jacobian led to
+    // a convergence failure.
+    if (precon->age() < m_preconMaxAge && t != m_preconReuseTime
+        && std::abs(gamma / m_preconGamma - 1.0) <= m_preconMaxGammaChange)
+    {
+        precon->setGamma(gamma);
+        precon->updatePreconditioner();
+        precon->incrementAge();
+        m_preconReuseTime = t;
+        m_preconJacobianCurrent = false;
+        return;
+    }
+    m_preconGamma = gamma;
+    m_preconReuseTime = NAN;
+    m_preconJacobianCurrent = true;
+    precon->setAge(0);
+    precon->incrementEvals();
+    // ensure state is up to date.
+    updateState(y);
     // Reset preconditioner
     precon->reset();
     // Set gamma value for M =I - gamma*J
@@ -705,8 +751,12 @@ void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
     // update network with adjusted state
     updateState(yCopy.data());
     // Get jacobians and give elements to preconditioners
+    vector<Eigen::SparseMatrix<double>> jacobians(m_reactors.size());
+    forEachReactor([&](size_t i) {
+        jacobians[i] = m_reactors[i]->jacobian();
+    });
     for (size_t i = 0; i < m_reactors.size(); i++) {
-        Eigen::SparseMatrix<double> rJac = m_reactors[i]->jacobian();
+        const auto& rJac = jacobians[i];
         for (int k=0; k<rJac.outerSize(); ++k) {
             for (Eigen::SparseMatrix<double>::InnerIterator it(rJac, k); it; ++it) {
                 precon->setValue(it.row() + m_start[i], it.col() + m_start[i],
@@ -718,6 +768,35 @@ void ReactorNet::preconditionerSetup(double t, double* y, double gamma)
     precon->updatePreconditioner();
 }
 
+void ReactorNet::setNumThreads(size_t nThreads)
+{
+    m_pool.reset();
+    if (nThreads != 1) {
+        m_pool = make_unique<ThreadPool>(nThreads);
+        if (m_pool->size() == 1) {
+            m_pool.reset();
+        }
+    }
+}
+
+size_t ReactorNet::numThreads() const
+{
+    return m_pool ? m_pool->size() : 1;
+}
+
+void ReactorNet::forEachReactor(const std::function<void(size_t)>& func)
+{
+    if (m_pool && m_independentReactors && m_reactors.size() > 1) {
+        m_pool->parallelFor(m_reactors.size(), [&](size_t n, size_t thread) {
+            func(n);
+        });
+    } else {
+        for (size_t n = 0; n < m_reactors.size(); n++) {
+            func(n);
+        }
+    }
+}
+
 void ReactorNet::updatePreconditioner(double gamma)
 {
     if (!m_integ) {
@@ -832,6 +911,14 @@ double SteadyReactorSolver::weightedNorm(const double* step) const
     return sqrt(sum / size());
 }
 
+void SteadyReactorSolver::getErrorWeights(double* ewt) const
+{
+    const double* x = m_state->data();
+    for (size_t i = 0; i < size(); i++) {
+        ewt[i] = m_net->rtol()*x[i] + m_net->atol();
+    }
+}
+
 string SteadyReactorSolver::componentName(size_t i) const
 {
     return m_net->componentName(i);
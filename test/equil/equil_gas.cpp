@@ -5,6 +5,7 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/Species.h"
 #include "cantera/equil/MultiPhase.h"
+#include "cantera/equil/ChemEquil.h"
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
@@ -310,6 +311,65 @@ TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
 // TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+TEST(ChemEquil, analytic_jacobian)
+{
+    auto gas = newThermo("gri30.yaml");
+    size_t nsp = gas->nSpecies();
+    for (const char* XY : {"TP", "HP", "SP", "SV", "TV", "UV"}) {
+        vector<double> X(nsp), Xref(nsp);
+        double T[2];
+        for (bool analytic : {false, true}) {
+            gas->setState_TPX(1200, 2e5, "CH4:0.3, O2:0.3, N2:0.4");
+            ChemEquil equil(*gas);
+            equil.options.analyticJacobian = analytic;
+            equil.options.relTolerance = 1e-12;
+            equil.equilibrate(*gas, XY);
+            gas->getMoleFractions(analytic ? X.data() : Xref.data());
+            T[analytic] = gas->temperature();
+        }
+        EXPECT_NEAR(T[1], T[0], 1e-8 * T[0]) << XY;
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(X[k], Xref[k], 1e-8 * Xref[k] + 1e-16) << XY << " " << k;
+        }
+    }
+}
+
+TEST(ChemEquil, starting_estimate)
+{
+    auto gas = newThermo("gri30.yaml");
+    size_t nsp = gas->nSpecies();
+    ChemEquil warm(*gas);
+    warm.options.contin = true;
+    vector<double> X(nsp), Xref(nsp);
+    for (double phi : {0.8, 0.85, 0.9, 1.5}) {
+        gas->setState_TP(600, OneAtm);
+        gas->setEquivalenceRatio(phi, "CH4:1", "O2:1, N2:3.76");
+        ChemEquil cold(*gas);
+        cold.equilibrate(*gas, "HP");
+        double Tref = gas->temperature();
+        gas->getMoleFractions(Xref.data());
+
+        // each calculation starts from the solution for the previous composition
+        gas->setState_TP(600, OneAtm);
+        gas->setEquivalenceRatio(phi, "CH4:1", "O2:1, N2:3.76");
+        warm.equilibrate(*gas, "HP");
+        gas->getMoleFractions(X.data());
+        EXPECT_NEAR(gas->temperature(), Tref, 1e-6 * Tref) << phi;
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(X[k], Xref[k], 1e-6 * Xref[k] + 1e-14) << phi << " " << k;
+        }
+    }
+
+    // A poor starting estimate falls back to the default estimate
+    gas->setState_TPX(300, OneAtm, "N2:1");
+    warm.setStartingEstimate(*gas);
+    gas->setState_TPX(600, OneAtm, "CH4:1, O2:2, N2:7.52");
+    double h0 = gas->enthalpy_mass();
+    warm.equilibrate(*gas, "HP");
+    EXPECT_NEAR(gas->enthalpy_mass(), h0, 1e-6 * std::abs(h0));
+    EXPECT_GT(gas->temperature(), 2300);
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
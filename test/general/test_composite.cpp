@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "cantera/base/Interface.h"
 #include "cantera/base/SolutionArray.h"
+#include "cantera/thermo/Species.h"
+#include "cantera/transport/Transport.h"
 
 using namespace Cantera;
 
@@ -29,6 +31,136 @@ TEST(Interface, from_AnyMap_and_Solution)
     ASSERT_EQ(surf->kinetics()->nReactions(), 24u);
 }
 
+TEST(Solution, clone)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "multicomponent");
+    auto gas = sol->thermo();
+    gas->setState_TPX(1500, 2 * OneAtm, "CH4:1, O2:2, N2:7.52, OH:0.01");
+    sol->kinetics()->setMultiplier(3, 2.5);
+    auto copy = sol->clone();
+    auto gas2 = copy->thermo();
+    ASSERT_NE(gas, gas2);
+    ASSERT_NE(sol->kinetics(), copy->kinetics());
+    ASSERT_NE(sol->transport(), copy->transport());
+    EXPECT_EQ(copy->name(), sol->name());
+    EXPECT_EQ(copy->transportModel(), "multicomponent");
+    EXPECT_EQ(copy->kinetics()->multiplier(3), 2.5);
+
+    // Reactions and species transport data are shared; species thermo is copied
+    EXPECT_EQ(copy->kinetics()->reaction(12), sol->kinetics()->reaction(12));
+    EXPECT_EQ(gas2->species(5)->transport, gas->species(5)->transport);
+    EXPECT_NE(gas2->species(5)->thermo, gas->species(5)->thermo);
+
+    size_t nsp = gas->nSpecies();
+    EXPECT_DOUBLE_EQ(gas2->temperature(), gas->temperature());
+    EXPECT_DOUBLE_EQ(gas2->pressure(), gas->pressure());
+    EXPECT_DOUBLE_EQ(gas2->enthalpy_mass(), gas->enthalpy_mass());
+    vector<double> wdot(nsp), wdot2(nsp), D(nsp * nsp), D2(nsp * nsp);
+    sol->kinetics()->getNetProductionRates(wdot.data());
+    copy->kinetics()->getNetProductionRates(wdot2.data());
+    sol->transport()->getMultiDiffCoeffs(nsp, D.data());
+    copy->transport()->getMultiDiffCoeffs(nsp, D2.data());
+    // Differences are limited to round-off in the composition
+    double scale = *std::max_element(wdot.begin(), wdot.end());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-12 * scale) << k;
+        for (size_t j = 0; j < nsp; j++) {
+            EXPECT_NEAR(D2[k * nsp + j], D[k * nsp + j], 1e-12 * D[k * nsp + j])
+                << k << ", " << j;
+        }
+    }
+    EXPECT_NEAR(copy->transport()->viscosity(), sol->transport()->viscosity(),
+                1e-12 * sol->transport()->viscosity());
+    EXPECT_NEAR(copy->transport()->thermalConductivity(),
+                sol->transport()->thermalConductivity(),
+                1e-12 * sol->transport()->thermalConductivity());
+
+    // Objects are independent
+    gas2->setState_TP(800, OneAtm);
+    EXPECT_DOUBLE_EQ(gas->temperature(), 1500);
+    EXPECT_LT(copy->transport()->viscosity(), sol->transport()->viscosity());
+    copy->kinetics()->setMultiplier(3, 1.0);
+    EXPECT_EQ(sol->kinetics()->multiplier(3), 2.5);
+}
+
+TEST(Solution, clone_modifyHf298)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto gas = sol->thermo();
+    size_t k = gas->speciesIndex("OH");
+    double hf = gas->Hf298SS(k);
+    gas->modifyOneHf298SS(k, hf + 1e6);
+    auto copy = sol->clone();
+    auto gas2 = copy->thermo();
+
+    // modifications made before cloning are copied
+    EXPECT_DOUBLE_EQ(gas2->Hf298SS(k), hf + 1e6);
+
+    // modifications made after cloning only affect one of the phases
+    gas->setState_TP(1200, OneAtm);
+    gas2->setState_TP(1200, OneAtm);
+    vector<double> h(gas->nSpecies()), h2(gas->nSpecies());
+    gas2->getEnthalpy_RT(h2.data());
+    gas->modifyOneHf298SS(k, hf - 1e6);
+    EXPECT_DOUBLE_EQ(gas->Hf298SS(k), hf - 1e6);
+    EXPECT_DOUBLE_EQ(gas2->Hf298SS(k), hf + 1e6);
+    gas2->getEnthalpy_RT(h.data());
+    EXPECT_EQ(h, h2);
+    gas->getEnthalpy_RT(h.data());
+    EXPECT_NEAR(h[k], h2[k] - 2e6 / (GasConstant * 1200), 1e-10 * std::abs(h2[k]));
+
+    gas2->resetHf298(k);
+    EXPECT_DOUBLE_EQ(gas->Hf298SS(k), hf - 1e6);
+}
+
+TEST(Solution, clone_unsupported)
+{
+    // setup of these phases depends on the root node of the input file
+    auto lattice = newSolution("thermo-models.yaml", "Li7Si3_and_interstitials");
+    EXPECT_THROW(lattice->clone(), NotImplementedError);
+    auto plasma = newSolution("oxygen-plasma.yaml",
+                              "isotropic-electron-energy-plasma", "none");
+    EXPECT_THROW(plasma->clone(), NotImplementedError);
+
+    // equilibrium calculations without threads do not require a copy
+    auto arr = SolutionArray::create(plasma, 2);
+    arr->equilibrate("TP");
+    EXPECT_THROW(arr->equilibrate("TP", "auto", 2), NotImplementedError);
+}
+
+TEST(Interface, clone)
+{
+    auto surf = newInterface("ptcombust.yaml", "Pt_surf");
+    auto gas = surf->adjacent("gas");
+    gas->thermo()->setState_TPX(900, OneAtm, "H2:0.05, O2:0.2, CH4:0.1, AR:0.65");
+    surf->thermo()->setState_TP(900, OneAtm);
+    surf->kinetics()->solvePseudoSteadyStateProblem();
+
+    auto copy = std::dynamic_pointer_cast<Interface>(surf->clone());
+    ASSERT_TRUE(copy);
+    ASSERT_EQ(copy->nAdjacent(), 1u);
+    auto gas2 = copy->adjacent("gas");
+    ASSERT_NE(gas2, gas);
+    EXPECT_EQ(&copy->kinetics()->thermo(0), copy->thermo().get());
+    EXPECT_EQ(copy->kinetics()->phase(1), gas2->thermo());
+    EXPECT_DOUBLE_EQ(gas2->thermo()->density(), gas->thermo()->density());
+
+    size_t nsp = surf->kinetics()->nTotalSpecies();
+    vector<double> wdot(nsp), wdot2(nsp), theta(surf->thermo()->nSpecies()),
+        theta2(theta.size());
+    surf->kinetics()->getNetProductionRates(wdot.data());
+    copy->kinetics()->getNetProductionRates(wdot2.data());
+    surf->thermo()->getCoverages(theta.data());
+    copy->thermo()->getCoverages(theta2.data());
+    double scale = *std::max_element(wdot.begin(), wdot.end());
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(wdot2[k], wdot[k], 1e-12 * scale) << k;
+    }
+    for (size_t k = 0; k < theta.size(); k++) {
+        EXPECT_NEAR(theta2[k], theta[k], 1e-14) << k;
+    }
+}
+
 TEST(SolutionArray, empty)
 {
     shared_ptr<Solution> gas;
@@ -129,6 +261,56 @@ TEST(SolutionArray, normalize)
     }
 }
 
+TEST(SolutionArray, equilibrate)
+{
+    auto gas = newSolution("h2o2.yaml",  "", "none");
+    auto& thermo = *gas->thermo();
+    int nStates = 24;
+    auto arr = SolutionArray::create(gas, nStates);
+    for (int loc = 0; loc < nStates; loc++) {
+        // Entries in a random order to exercise the reordering
+        int i = (7 * loc) % nStates;
+        double phi = 0.4 + 0.1 * (i % 12);
+        thermo.setState_TP(300 + 100 * (i / 12), OneAtm * (1 + i % 3));
+        thermo.setEquivalenceRatio(phi, "H2:1", "O2:1, AR:3.76");
+        arr->updateState(loc);
+    }
+    auto reference = SolutionArray::create(gas, nStates);
+    for (int loc = 0; loc < nStates; loc++) {
+        reference->setState(loc, arr->getState(loc));
+    }
+
+    for (string XY : {"HP", "TP"}) {
+        vector<vector<double>> expected(nStates);
+        for (int loc = 0; loc < nStates; loc++) {
+            thermo.restoreState(reference->getState(loc));
+            thermo.equilibrate(XY);
+            thermo.saveState(expected[loc]);
+        }
+        for (size_t nThreads : {1, 3}) {
+            auto equil = SolutionArray::create(gas, nStates);
+            for (int loc = 0; loc < nStates; loc++) {
+                equil->setState(loc, reference->getState(loc));
+            }
+            equil->equilibrate(XY, "auto", nThreads);
+            for (int loc = 0; loc < nStates; loc++) {
+                auto state = equil->getState(loc);
+                for (size_t n = 0; n < state.size(); n++) {
+                    EXPECT_NEAR(state[n], expected[loc][n],
+                                1e-6 * std::abs(expected[loc][n]) + 1e-12)
+                        << XY << " entry " << loc << " component " << n;
+                }
+                auto aux = equil->getAuxiliary(loc);
+                EXPECT_EQ(aux["equil-solver"].asString(), "element_potential");
+                EXPECT_GT(aux["equil-iterations"].asInt(), 0);
+            }
+        }
+    }
+
+    ASSERT_THROW(arr->equilibrate("XY"), CanteraError);
+    ASSERT_THROW(arr->equilibrate("TP", "foo"), CanteraError);
+}
+
 TEST(SolutionArray, meta)
 {
     auto gas = newSolution("h2o2.yaml",  "", "none");
@@ -2,6 +2,8 @@
 #include "gmock/gmock.h"
 #include "cantera/base/AnyMap.h"
 
+#include <random>
+
 using namespace Cantera;
 
 TEST(AnyValue, is_copyable) {
@@ -506,3 +508,54 @@ TEST(AnyMap, definedKeyOrdering)
     EXPECT_LT(loc["three"], loc["five"]);
     EXPECT_LT(loc["six"], loc["one"]);
 }
+
+TEST(AnyMap, inputCache)
+{
+    // Use a unique directory so concurrent test runs don't share cache files
+    auto cacheDir = std::filesystem::temp_directory_path() / fmt::format(
+        "cantera-input-cache-{:x}", std::random_device()());
+    std::filesystem::remove_all(cacheDir);
+    AnyMap::clearCachedFile("h2o2.yaml");
+    AnyMap original = AnyMap::fromYamlFile("h2o2.yaml");
+
+    AnyMap::setInputCacheDir(cacheDir.string());
+    EXPECT_EQ(AnyMap::inputCacheDir(), cacheDir.string());
+    // The first call parses the YAML file and creates the cache file
+    AnyMap::clearCachedFile("h2o2.yaml");
+    AnyMap written = AnyMap::fromYamlFile("h2o2.yaml");
+    size_t nFiles = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(cacheDir)) {
+        EXPECT_EQ(entry.path().extension(), ".bin");
+        nFiles++;
+    }
+    EXPECT_EQ(nFiles, 1u);
+
+    // The second call reads the cache file
+    AnyMap::clearCachedFile("h2o2.yaml");
+    AnyMap cached = AnyMap::fromYamlFile("h2o2.yaml");
+    AnyMap::setInputCacheDir("");
+    AnyMap::clearCachedFile("h2o2.yaml");
+
+    EXPECT_TRUE(cached == original);
+    EXPECT_TRUE(written == original);
+    EXPECT_EQ(cached.toYamlString(), original.toYamlString());
+    auto& data = cached["species"].getMapWhere("name", "OH")["thermo"]["data"];
+    auto& data0 = original["species"].getMapWhere("name", "OH")["thermo"]["data"];
+    EXPECT_EQ(data.asVector<vector<double>>(), data0.asVector<vector<double>>());
+
+    // Input file locations are preserved for error messages
+    string msg, msg0;
+    try {
+        data.asVector<string>();
+    } catch (CanteraError& err) {
+        msg = err.getMessage();
+    }
+    try {
+        data0.asVector<string>();
+    } catch (CanteraError& err) {
+        msg0 = err.getMessage();
+    }
+    EXPECT_THAT(msg, ::testing::HasSubstr("h2o2.yaml"));
+    EXPECT_EQ(msg, msg0);
+    std::filesystem::remove_all(cacheDir);
+}
@@ -5,6 +5,8 @@
 #include "gmock/gmock.h"
 #include "cantera/base/global.h"
 #include "cantera/base/Solution.h"
+#include "cantera/base/ThreadPool.h"
+#include <atomic>
 
 using namespace Cantera;
 using ::testing::HasSubstr;
@@ -30,3 +32,43 @@ TEST(CanteraError, stacktrace) {
     }
     EXPECT_TRUE(raised);
 }
+
+TEST(ThreadPool, parallelFor) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    vector<size_t> owner(103, npos);
+    vector<int> count(103, 0);
+    for (int rep = 0; rep < 3; rep++) {
+        pool.parallelFor(owner.size(), [&](size_t i, size_t thread) {
+            EXPECT_LT(thread, pool.size());
+            // each index is always evaluated by the same thread
+            if (rep == 0) {
+                owner[i] = thread;
+            } else {
+                EXPECT_EQ(owner[i], thread);
+            }
+            count[i]++;
+        });
+    }
+    for (size_t i = 0; i < owner.size(); i++) {
+        EXPECT_EQ(count[i], 3);
+        if (i) {
+            EXPECT_GE(owner[i], owner[i-1]); // contiguous blocks
+        }
+    }
+    EXPECT_EQ(owner.back(), 3u);
+}
+
+TEST(ThreadPool, exceptions) {
+    ThreadPool pool(3);
+    auto func = [](size_t i, size_t thread) {
+        if (i == 7 || i == 8) {
+            throw CanteraError("test", "failed on iteration {}", i);
+        }
+    };
+    EXPECT_THROW(pool.parallelFor(9, func), CanteraError);
+    // pool remains usable after an exception
+    std::atomic<size_t> sum{0};
+    pool.parallelFor(10, [&](size_t i, size_t thread) { sum += i; });
+    EXPECT_EQ(sum, 45u);
+}
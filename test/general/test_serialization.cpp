@@ -9,6 +9,7 @@
 #include "cantera/kinetics.h"
 #include "cantera/transport/TransportData.h"
 #include "cantera/base/Storage.h"
+#include "cantera/base/SolutionArray.h"
 #include <fstream>
 
 using namespace Cantera;
@@ -401,6 +402,124 @@ TEST(YamlWriter, customHeader)
     ASSERT_EQ(soln->header()["spam"].asString(), "eggs");
 }
 
+TEST(SolutionArray, csvRoundTrip)
+{
+    const string fname = "solutionarray.csv";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto sol = newSolution("h2o2.yaml",  "", "none");
+    auto gas = sol->thermo();
+    auto arr = SolutionArray::create(sol);
+    arr->addExtra("index", false);
+    arr->addExtra("time");
+    arr->addExtra("label");
+    vector<double> state(gas->stateSize());
+    for (long int i = 0; i < 5; i++) {
+        gas->setState_TPX(300. + 150. * i, OneAtm * (1 + i), "H2:2, O2:1, AR:5");
+        gas->saveState(state);
+        AnyMap extra;
+        extra["index"] = i;
+        extra["time"] = 1e-4 * i;
+        extra["label"] = fmt::format("point {}, mixture", i);
+        arr->append(state, extra);
+    }
+
+    for (const string basis : {"mass", "mole"}) {
+        arr->save(fname, "", "", "", true, 0, basis);
+        auto restored = SolutionArray::create(sol);
+        restored->restore(fname, "");
+        ASSERT_EQ(restored->size(), 5);
+        EXPECT_EQ(restored->componentNames(), arr->componentNames());
+        ASSERT_TRUE(restored->getComponent("index").isVector<long int>());
+        ASSERT_TRUE(restored->getComponent("time").isVector<double>());
+        ASSERT_TRUE(restored->getComponent("label").isVector<string>());
+        EXPECT_EQ(restored->getComponent("label").asVector<string>()[3],
+                  "point 3, mixture");
+        for (const auto& name : {"T", "D", "H2", "O2", "AR", "index", "time"}) {
+            auto expected = arr->getComponent(name).asVector<double>();
+            auto actual = restored->getComponent(name).asVector<double>();
+            for (size_t i = 0; i < 5; i++) {
+                EXPECT_NEAR(actual[i], expected[i], 1e-8 * std::abs(expected[i]))
+                    << name << ", " << i;
+            }
+        }
+    }
+    std::remove(fname.c_str());
+}
+
+TEST(SolutionArray, csvInvalid)
+{
+    const string fname = "solutionarray-invalid.csv";
+    auto sol = newSolution("h2o2.yaml",  "", "none");
+    auto arr = SolutionArray::create(sol);
+    {
+        std::ofstream out(fname);
+        out << "T,P,X_H2,X_O2\n300,101325,0.5,0.5\n400,101325,0.5\n";
+    }
+    EXPECT_THROW(arr->restore(fname, ""), CanteraError);
+    {
+        std::ofstream out(fname);
+        out << "T,X_H2,X_O2\n300,0.5,0.5\n";
+    }
+    EXPECT_THROW(arr->restore(fname, ""), CanteraError);
+    {
+        std::ofstream out(fname);
+        out << "T,P,X_H2,Y_O2\n300,101325,0.5,0.5\n";
+    }
+    EXPECT_THROW(arr->restore(fname, ""), CanteraError);
+    {
+        // Windows line endings and non-native state definition
+        std::ofstream out(fname);
+        out << "T,P,X_H2,X_O2\r\n300,101325,0.5,0.5\r\n";
+    }
+    arr->restore(fname, "");
+    ASSERT_EQ(arr->size(), 1);
+    EXPECT_DOUBLE_EQ(arr->getComponent("T").asVector<double>()[0], 300.);
+    std::remove(fname.c_str());
+}
+
+TEST(SolutionArray, csvEscapedQuotes)
+{
+    const string fname = "solutionarray-quotes.csv";
+    auto sol = newSolution("h2o2.yaml",  "", "none");
+    auto arr = SolutionArray::create(sol);
+    {
+        // quotes within quoted fields are escaped by doubling them (RFC 4180)
+        std::ofstream out(fname);
+        out << "T,P,X_H2,X_O2,\"the \"\"label\"\", quoted\",note\n"
+            << "300,101325,0.5,0.5,\"a \"\"b\"\", c\",\"\"\"\"\n"
+            << "400,101325,0.5,0.5,\"\",plain\n";
+    }
+    arr->restore(fname, "");
+    ASSERT_EQ(arr->size(), 2);
+    ASSERT_TRUE(arr->hasComponent("the \"label\", quoted"));
+    auto label = arr->getComponent("the \"label\", quoted").asVector<string>();
+    EXPECT_EQ(label[0], "a \"b\", c");
+    EXPECT_EQ(label[1], "");
+    auto note = arr->getComponent("note").asVector<string>();
+    EXPECT_EQ(note[0], "\"");
+    EXPECT_EQ(note[1], "plain");
+    std::remove(fname.c_str());
+}
+
+TEST(SolutionArray, csvLeadingEmptyLines)
+{
+    const string fname = "solutionarray-empty-lines.csv";
+    auto sol = newSolution("h2o2.yaml",  "", "none");
+    auto arr = SolutionArray::create(sol);
+    {
+        // the header is the first non-empty line
+        std::ofstream out(fname);
+        out << "\n\r\nT,P,X_H2,X_O2\n\n300,101325,0.5,0.5\n400,101325,0.5,0.5\n";
+    }
+    arr->restore(fname, "");
+    ASSERT_EQ(arr->size(), 2);
+    EXPECT_DOUBLE_EQ(arr->getComponent("T").asVector<double>()[0], 300.);
+    EXPECT_DOUBLE_EQ(arr->getComponent("T").asVector<double>()[1], 400.);
+    std::remove(fname.c_str());
+}
+
 #if CT_USE_HDF5
 
 TEST(Storage, groups)
@@ -717,6 +836,188 @@ TEST(Storage, readCompressed)
     ASSERT_TRUE(data.isMatrix<string>());
 }
 
+TEST(Storage, stridedData)
+{
+    // testing Storage class outside of SolutionArray
+    const string fname = "stridedData.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto file = unique_ptr<Storage>(new Storage(fname, true));
+    file->checkGroup("test", true); // implicitly creates group
+    file->setCompressionLevel(5);
+
+    // strided buffer holding four rows with five entries each
+    vector<double> buffer(20);
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = 1.0 * i;
+    }
+    file->writeData("test", "matrix", &buffer[1], 4, 3, 5);
+    file->writeData("test", "vector", &buffer[4], 4, 0, 5);
+    file->writeData("test", "contiguous", &buffer[0], 20);
+    // stride needs to accommodate columns
+    EXPECT_THROW(file->writeData("test", "invalid", &buffer[0], 4, 6, 5), CanteraError);
+    // overwriting of existing data doesn't work
+    EXPECT_THROW(file->writeData("test", "vector", &buffer[0], 4), CanteraError);
+
+    file = unique_ptr<Storage>(new Storage(fname, false));
+    // data written from strided buffer is consistent with AnyValue interface
+    auto data = file->readData("test", "matrix", 4, 3);
+    const auto& matrix = data.asVector<vector<double>>();
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            EXPECT_EQ(matrix[i][j], buffer[5 * i + j + 1]);
+        }
+    }
+
+    // read into strided buffer; unselected entries are not modified
+    vector<double> target(20, -1.0);
+    file->readData("test", "matrix", &target[1], 4, 3, 5);
+    file->readData("test", "vector", &target[4], 4, 0, 5);
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(target[5 * i], -1.0);
+        for (size_t j = 1; j < 5; j++) {
+            EXPECT_EQ(target[5 * i + j], buffer[5 * i + j]);
+        }
+    }
+    file->readData("test", "contiguous", target.data(), 20);
+    EXPECT_EQ(target, buffer);
+
+    // inconsistent shapes
+    EXPECT_THROW(file->readData("test", "matrix", &target[0], 3, 3, 5), CanteraError);
+    EXPECT_THROW(file->readData("test", "matrix", &target[0], 4, 2, 5), CanteraError);
+    EXPECT_THROW(file->readData("test", "vector", &target[0], 4, 1, 5), CanteraError);
+}
+
+TEST(Storage, appendData)
+{
+    // testing Storage class outside of SolutionArray
+    const string fname = "appendData.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto file = unique_ptr<Storage>(new Storage(fname, true));
+    file->checkGroup("test", true); // implicitly creates group
+    file->setChunkSize(2);
+    EXPECT_THROW(file->setChunkSize(0), CanteraError);
+
+    // strided buffer holding three rows with five entries each
+    vector<double> buffer(15);
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = 1.0 * i;
+    }
+    // append columns 1-3 as matrix and column 4 as vector
+    EXPECT_EQ(file->appendData("test", "matrix", &buffer[1], 3, 3, 5), 3u);
+    EXPECT_EQ(file->appendData("test", "vector", &buffer[4], 3, 0, 5), 3u);
+    EXPECT_EQ(file->appendData("test", "matrix", &buffer[6], 2, 3, 5), 5u);
+    EXPECT_EQ(file->appendData("test", "vector", &buffer[9], 2, 0, 5), 5u);
+    // inconsistent shape
+    EXPECT_THROW(file->appendData("test", "matrix", &buffer[0], 1, 2, 5), CanteraError);
+    EXPECT_THROW(file->appendData("test", "vector", &buffer[0], 1, 2, 5), CanteraError);
+    EXPECT_THROW(file->appendData("test", "other", &buffer[0], 1, 6, 5), CanteraError);
+
+    AnyValue any;
+    any = vector<long int>({1, 2});
+    EXPECT_EQ(file->appendData("test", "integer-vector", any), 2u);
+    EXPECT_EQ(file->appendData("test", "integer-vector", any), 4u);
+    any = vector<string>({"dog", "cat"});
+    EXPECT_EQ(file->appendData("test", "string-vector", any), 2u);
+    any = vector<string>({"spam"});
+    EXPECT_EQ(file->appendData("test", "string-vector", any), 3u);
+    any = vector<bool>({true, false});
+    EXPECT_THROW(file->appendData("test", "invalid", any), NotImplementedError);
+
+    // datasets created by writeData are not extensible
+    any = vector<double>({1.1, 2.2});
+    file->writeData("test", "fixed", any);
+    EXPECT_THROW(file->appendData("test", "fixed", any), CanteraError);
+
+    file = unique_ptr<Storage>(new Storage(fname, false));
+    auto data = file->readData("test", "matrix", 5, 3);
+    ASSERT_TRUE(data.isMatrix<double>());
+    const auto& matrix = data.asVector<vector<double>>();
+    data = file->readData("test", "vector", 5, 0);
+    const auto& vec = data.asVector<double>();
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            EXPECT_EQ(matrix[i][j], buffer[5 * i + j + 1]);
+        }
+        EXPECT_EQ(vec[i], buffer[5 * i + 4]);
+    }
+    for (size_t i = 3; i < 5; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            EXPECT_EQ(matrix[i][j], buffer[5 * (i - 2) + j + 1]);
+        }
+        EXPECT_EQ(vec[i], buffer[5 * (i - 2) + 4]);
+    }
+    data = file->readData("test", "string-vector", 3);
+    EXPECT_EQ(data.asVector<string>()[2], "spam");
+}
+
+TEST(SolutionArray, appendEntry)
+{
+    const string fname = "appendEntry.h5";
+    if (std::ifstream(fname).good()) {
+        std::remove(fname.c_str());
+    }
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    auto gas = sol->thermo();
+    auto arr = SolutionArray::create(sol);
+    arr->addExtra("t");
+    vector<double> state(gas->stateSize());
+    size_t total = 0;
+    for (size_t batch = 0; batch < 3; batch++) {
+        for (size_t i = 0; i < 4; i++) {
+            double t = 4 * batch + i;
+            gas->setState_TPX(300. + 100. * t, OneAtm, "H2:1, O2:1, AR:3");
+            gas->saveState(state);
+            AnyMap extra;
+            extra["t"] = t;
+            arr->append(state, extra);
+        }
+        total = arr->appendEntry(fname, "history", "", 0, 2);
+        arr->resize(0);
+    }
+    EXPECT_EQ(total, 12u);
+
+    auto restored = SolutionArray::create(sol);
+    restored->restore(fname, "history");
+    ASSERT_EQ(restored->size(), 12);
+    auto T = restored->getComponent("T").asVector<double>();
+    auto t = restored->getComponent("t").asVector<double>();
+    for (size_t i = 0; i < 12; i++) {
+        EXPECT_DOUBLE_EQ(T[i], 300. + 100. * i);
+        EXPECT_DOUBLE_EQ(t[i], 1.0 * i);
+    }
+
+    // emulate a call that was interrupted after extending only some datasets
+    {
+        Storage file(fname, true);
+        vector<double> partial = {1e4, 2e4};
+        EXPECT_EQ(file.appendData("history/data", "T", partial.data(), 2), 14u);
+    }
+    restored->restore(fname, "history");
+    ASSERT_EQ(restored->size(), 12);
+
+    // partial rows are overwritten by the next call
+    gas->setState_TPX(1500., OneAtm, "H2:1, O2:1, AR:3");
+    gas->saveState(state);
+    AnyMap extra;
+    extra["t"] = 12.;
+    arr->append(state, extra);
+    EXPECT_EQ(arr->appendEntry(fname, "history", "", 0, 2), 13u);
+    restored->restore(fname, "history");
+    ASSERT_EQ(restored->size(), 13);
+    T = restored->getComponent("T").asVector<double>();
+    t = restored->getComponent("t").asVector<double>();
+    EXPECT_DOUBLE_EQ(T[12], 1500.);
+    EXPECT_DOUBLE_EQ(t[12], 12.);
+
+    // components need to be consistent
+    arr->addExtra("spam");
+    EXPECT_THROW(arr->appendEntry(fname, "history"), CanteraError);
+}
+
 #else
 
 TEST(Storage, noSupport)
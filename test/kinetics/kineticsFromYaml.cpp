@@ -595,6 +595,74 @@ TEST(Kinetics, BulkKineticsFromYaml2)
     EXPECT_EQ(kin->nReactions(), (size_t) 3);
 }
 
+void checkNetProductionRatesBatch(const string& mech, const string& phase,
+                                  const string& X)
+{
+    auto sol = newSolution(mech, phase, "none");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    size_t nsp = gas->nSpecies();
+    gas->setState_TPX(500, OneAtm, X);
+    vector<double> state0;
+    gas->saveState(state0);
+
+    // number of states exceeds the size of blocks processed by BulkKinetics
+    size_t n = 150;
+    vector<double> T(n), P(n), Y(n * nsp), wdot(n * nsp);
+    auto ref = newSolution(mech, phase, "none");
+    vector<double> X0(nsp), Xi(nsp);
+    ref->thermo()->setMoleFractionsByName(X);
+    ref->thermo()->getMoleFractions(X0.data());
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 800. + 10. * i;
+        P[i] = OneAtm * (0.1 + 0.2 * (i % 30));
+        for (size_t k = 0; k < nsp; k++) {
+            Xi[k] = X0[k] + 1e-4 * ((i + k) % 7);
+        }
+        ref->thermo()->setState_TPX(T[i], P[i], Xi.data());
+        ref->thermo()->getMassFractions(&Y[i * nsp]);
+    }
+    kin->getNetProductionRatesBatch(n, T.data(), P.data(), Y.data(), wdot.data());
+
+    vector<double> wdot_ref(nsp), cdot_ref(nsp);
+    for (size_t i = 0; i < n; i++) {
+        ref->thermo()->setState_TPY(T[i], P[i], &Y[i * nsp]);
+        ref->kinetics()->getNetProductionRates(wdot_ref.data());
+        ref->kinetics()->getCreationRates(cdot_ref.data());
+        double scale = *std::max_element(cdot_ref.begin(), cdot_ref.end());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(wdot[i * nsp + k], wdot_ref[k], 1e-12 * scale)
+                << mech << ", state " << i << ", species " << k;
+        }
+    }
+
+    // state of the phase is unchanged
+    vector<double> state1;
+    gas->saveState(state1);
+    ASSERT_EQ(state0.size(), state1.size());
+    for (size_t j = 0; j < state0.size(); j++) {
+        EXPECT_DOUBLE_EQ(state0[j], state1[j]);
+    }
+}
+
+TEST(Kinetics, NetProductionRatesBatch)
+{
+    checkNetProductionRatesBatch("gri30.yaml", "gri30",
+                                 "CH4:1, O2:2, N2:7.52, OH:0.01, H:0.01, CO:0.1");
+    checkNetProductionRatesBatch("pdep-test.yaml", "", "H:0.1, R1A:0.2, R2:0.3, "
+                                 "R3:0.1, R4:0.1, R5:0.1, R6:0.1, P1:0.1, P3A:0.1");
+    checkNetProductionRatesBatch("blowers-masel.yaml", "gas",
+                                 "H2:0.2, O2:0.2, H:0.1, O:0.1, OH:0.1, H2O:0.1, AR:0.2");
+
+    // not implemented for interface kinetics
+    auto surf = newInterface("ptcombust.yaml", "Pt_surf");
+    vector<double> T{900.}, P{OneAtm};
+    vector<double> Y(surf->thermo()->nSpecies(), 0.1);
+    vector<double> wdot(surf->kinetics()->nTotalSpecies());
+    EXPECT_THROW(surf->kinetics()->getNetProductionRatesBatch(
+        1, T.data(), P.data(), Y.data(), wdot.data()), NotImplementedError);
+}
+
 TEST(Kinetics, EfficienciesFromYaml)
 {
     AnyMap infile = AnyMap::fromYamlFile("ideal-gas.yaml");
@@ -1,8 +1,15 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo.h"
 #include "cantera/kinetics.h"
+#include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/BlowersMaselRate.h"
+#include "cantera/kinetics/ChebyshevRate.h"
+#include "cantera/kinetics/PlogRate.h"
+#include "cantera/kinetics/TwoTempPlasmaRate.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
 #include "cantera/thermo/ThermoFactory.h"
 #include "cantera/thermo/IdealGasPhase.h"
+#include "cantera/thermo/SurfPhase.h"
 #include "cantera/base/Solution.h"
 #include "cantera/base/Interface.h"
 
@@ -176,6 +183,55 @@ TEST(InterfaceReaction, CoverageDependency) {
     EXPECT_NEAR(kf[1], 3.7e20 * exp(-(67.4e6-6e6*0.3)/(GasConstant*T)), 1e-14*kf[1]);
 }
 
+TEST(InterfaceKinetics, PseudoSteadyStateAnalyticJacobian) {
+    // Steady state coverages computed with finite difference and analytic Jacobians
+    // should agree. With coverage-dependent rates, the analytic Jacobian is only
+    // available if the coverage dependence is skipped.
+    for (bool skipCoverageDependence : {false, true}) {
+        vector<vector<double>> coverages;
+        for (bool analytic : {false, true}) {
+            auto iface = newInterface("ptcombust.yaml", "Pt_surf");
+            auto gas = iface->adjacent("gas");
+            gas->thermo()->setState_TPX(900, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+            iface->thermo()->setState_TP(900, OneAtm);
+            AnyMap settings;
+            settings["skip-coverage-dependence"] = skipCoverageDependence;
+            iface->kinetics()->setDerivativeSettings(settings);
+            auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(iface->kinetics());
+            vector<InterfaceKinetics*> objects{kin.get()};
+            ImplicitSurfChem surfChem(objects);
+            surfChem.initialize();
+            surfChem.setAnalyticJacobian(analytic);
+            surfChem.solvePseudoSteadyStateProblem();
+            auto surf = std::dynamic_pointer_cast<SurfPhase>(iface->thermo());
+            coverages.emplace_back(surf->nSpecies());
+            surf->getCoverages(coverages.back().data());
+
+            // Check which Jacobian was used, starting again from the initial state
+            surf->setCoveragesByName("PT(S): 0.5, H(S): 0.5");
+            solveSP solver(&surfChem);
+            solver.setAnalyticJacobian(analytic);
+            ASSERT_EQ(solver.solveSurfProb(SFLUX_INITIALIZE, 1.0, 900, OneAtm,
+                                           1e-6, 1e-20), 1);
+            if (analytic && skipCoverageDependence) {
+                EXPECT_GT(solver.nAnalyticJacobianEvals(), 0);
+                EXPECT_EQ(solver.nFiniteDifferenceJacobianEvals(), 0);
+            } else {
+                EXPECT_EQ(solver.nAnalyticJacobianEvals(), 0);
+                EXPECT_GT(solver.nFiniteDifferenceJacobianEvals(), 0);
+            }
+            vector<double> theta(surf->nSpecies());
+            surf->getCoverages(theta.data());
+            for (size_t k = 0; k < theta.size(); k++) {
+                EXPECT_NEAR(theta[k], coverages.back()[k], 1e-6 * theta[k] + 1e-14);
+            }
+        }
+        for (size_t k = 0; k < coverages[0].size(); k++) {
+            EXPECT_NEAR(coverages[1][k], coverages[0][k], 1e-6 * coverages[0][k]);
+        }
+    }
+}
+
 TEST(LinearBurkeRate, RateCombinations)
 {
     auto sol = newSolution("linearBurke-test.yaml", "linear-Burke-complex", "none");
@@ -247,5 +303,146 @@ TEST(LinearBurkeRate, RateCombinations)
                 kf(2, T, Peff_P3A) * Pr_P3A + kf(1, T, Peff_M) * Pr_R6, atol);
 }
 
+TEST(MultiRate, PackedArrhenius)
+{
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto kin = sol->kinetics();
+    auto evaluator = ArrheniusRate().newMultiRate();
+    vector<size_t> indices;
+    size_t iOther = npos;
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        auto rate = kin->reaction(i)->rate();
+        if (rate->type() == "Arrhenius") {
+            evaluator->add(i, *rate);
+            indices.push_back(i);
+        } else {
+            iOther = i;
+        }
+    }
+    ASSERT_GT(indices.size(), 200u);
+    vector<double> kf(kin->nReactions(), -1.0);
+    for (double T : {300., 1234.5, 2800.}) {
+        evaluator->update(T);
+        evaluator->getRateConstants(kf.data());
+        for (size_t i : indices) {
+            EXPECT_DOUBLE_EQ(kf[i], kin->reaction(i)->rate()->eval(T));
+        }
+    }
+    // entries of other reaction types are not touched
+    ASSERT_NE(iOther, npos);
+    EXPECT_EQ(kf[iOther], -1.0);
+
+    // replaced rates are reflected in packed parameters
+    ArrheniusRate modified(2.5e6, 1.5, 4.2e7);
+    evaluator->replace(indices[3], modified);
+    evaluator->update(1000.);
+    evaluator->getRateConstants(kf.data());
+    EXPECT_DOUBLE_EQ(kf[indices[3]], modified.eval(1000.));
+}
+
+TEST(MultiRate, PackedBlowersMasel)
+{
+    vector<BlowersMaselRate> rates = {
+        {3.87e+04, 2.7, 6.26e+07, 1e9}, {1.0e+13, 0.0, 4.2e+07, 6e8},
+        {-2.0e+10, 0.5, 1.0e+07, 1e9}};
+    vector<double> deltaH = {-2.5e8, 1.2e7, 3.0e8};
+    auto evaluator = rates[0].newMultiRate();
+    for (size_t i = 0; i < rates.size(); i++) {
+        rates[i].setAllowNegativePreExponentialFactor(true);
+        rates[i].setDeltaH(deltaH[i]);
+        evaluator->add(2 * i, rates[i]);
+    }
+    vector<double> kf(2 * rates.size(), 0.0);
+    evaluator->update(1500.);
+    evaluator->getRateConstants(kf.data());
+    for (size_t i = 0; i < rates.size(); i++) {
+        EXPECT_DOUBLE_EQ(kf[2 * i], rates[i].eval(1500.));
+    }
+}
+
+TEST(MultiRate, PackedTwoTempPlasma)
+{
+    vector<TwoTempPlasmaRate> rates = {
+        {17283, -3.1, -5820000, 1081000}, {1.2e10, 0.5, 3.4e7, -2.2e7}};
+    auto evaluator = rates[0].newMultiRate();
+    for (size_t i = 0; i < rates.size(); i++) {
+        evaluator->add(i, rates[i]);
+    }
+    vector<double> kf(rates.size(), 0.0);
+    for (double Te : {300., 1500., 2.0e4}) {
+        evaluator->update(1000., Te);
+        evaluator->getRateConstants(kf.data());
+        for (size_t i = 0; i < rates.size(); i++) {
+            EXPECT_NEAR(kf[i], rates[i].eval(1000., Te), 1e-13 * std::abs(kf[i]));
+        }
+    }
+}
+
+//! Compare packed evaluation of pressure-dependent rates of the specified type with
+//! the evaluation of individual rate objects
+void checkPackedPdepRates(const string& type)
+{
+    auto sol = newSolution("pdep-test.yaml", "gas", "none");
+    auto kin = sol->kinetics();
+    unique_ptr<MultiRateBase> evaluator;
+    vector<size_t> indices;
+    for (size_t i = 0; i < kin->nReactions(); i++) {
+        auto rate = kin->reaction(i)->rate();
+        if (rate->type() == type) {
+            if (!evaluator) {
+                evaluator = rate->newMultiRate();
+            }
+            evaluator->add(i, *rate);
+            indices.push_back(i);
+        }
+    }
+    ASSERT_GE(indices.size(), 3u);
+    vector<double> kf(kin->nReactions(), -1.0);
+    for (double P : {1e3, 0.03 * OneAtm, OneAtm, 20 * OneAtm, 1e9}) {
+        for (double T : {300., 1234.5, 2000.}) {
+            evaluator->update(T, P);
+            evaluator->getRateConstants(kf.data());
+            for (size_t i : indices) {
+                double k = kin->reaction(i)->rate()->eval(T, P);
+                EXPECT_NEAR(kf[i], k, 1e-13 * k)
+                    << "reaction " << i << " at T = " << T << ", P = " << P;
+            }
+        }
+    }
+
+    // numerical derivatives with respect to pressure
+    double T = 1100.;
+    double P = 3 * OneAtm;
+    double deltaP = 1e-6;
+    evaluator->update(T, P);
+    evaluator->getRateConstants(kf.data());
+    vector<double> ddP(kin->nReactions(), 1.0);
+    evaluator->processRateConstants_ddP(ddP.data(), kf.data(), deltaP);
+    for (size_t i : indices) {
+        auto rate = kin->reaction(i)->rate();
+        double k0 = rate->eval(T, P);
+        double expected = (rate->eval(T, P * (1 + deltaP)) / k0 - 1) / (P * deltaP);
+        EXPECT_NEAR(ddP[i], expected, 1e-6 * std::abs(expected));
+    }
+
+    // replaced rates are reflected in packed parameters
+    auto replacement = kin->reaction(indices[1])->rate();
+    evaluator->replace(indices[0], *replacement);
+    evaluator->update(T, P);
+    evaluator->getRateConstants(kf.data());
+    double k = replacement->eval(T, P);
+    EXPECT_NEAR(kf[indices[0]], k, 1e-13 * k);
+    EXPECT_DOUBLE_EQ(kf[indices[0]], kf[indices[1]]);
+}
+
+TEST(MultiRate, PackedChebyshev)
+{
+    checkPackedPdepRates("Chebyshev");
+}
+
+TEST(MultiRate, PackedPlog)
+{
+    checkPackedPdepRates("pressure-dependent-Arrhenius");
+}
 
 }
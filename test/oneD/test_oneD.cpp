@@ -6,6 +6,9 @@
 #include "cantera/onedim.h"
 #include "cantera/oneD/DomainFactory.h"
 #include "cantera/oneD/IonFlow.h"
+#include "cantera/oneD/MultiNewton.h"
+#include "cantera/numerics/EigenSparseDirectJacobian.h"
+#include "cantera/numerics/SystemJacobianFactory.h"
 
 using namespace Cantera;
 
@@ -96,6 +99,344 @@ TEST(onedim, freeflame)
     }
 }
 
+//! Set up a free flame in h2o2 with a simple initial guess
+shared_ptr<Sim1D> setupFreeFlame(shared_ptr<Solution> sol, int nz)
+{
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    string X = "H2:0.65, O2:0.5, AR:2";
+    gas->setState_TPX(300, OneAtm, X);
+    double rho_in = gas->density();
+    vector<double> yin(nsp);
+    gas->getMassFractions(yin.data());
+    gas->equilibrate("HP");
+    vector<double> yout(nsp);
+    gas->getMassFractions(yout.data());
+    double Tad = gas->temperature();
+
+    auto flow = newFlow1D("free-flow", sol, "flow");
+    flow->setupUniformGrid(nz, 0.02);
+    auto inlet = newBoundary1D("inlet", sol);
+    inlet->setMoleFractions(X);
+    inlet->setMdot(0.3 * rho_in);
+    inlet->setTemperature(300);
+    auto outlet = newBoundary1D("outlet", sol);
+    vector<shared_ptr<Domain1D>> domains { inlet, flow, outlet };
+    auto flame = newSim1D(domains);
+
+    vector<double> locs{0.0, 0.3, 0.7, 1.0};
+    vector<double> value{300, 300, Tad, Tad};
+    flame->setInitialGuess("T", locs, value);
+    for (size_t k = 0; k < nsp; k++) {
+        value = {yin[k], yin[k], yout[k], yout[k]};
+        flame->setInitialGuess(gas->speciesName(k), locs, value);
+    }
+    flow->solveEnergyEqn();
+    flame->setFixedTemperature(600);
+    return flame;
+}
+
+//! Get the global solution vector of a Sim1D object
+vector<double> getState(Sim1D& sim)
+{
+    vector<double> x(sim.size());
+    for (size_t n = 0; n < sim.nDomains(); n++) {
+        auto& dom = sim.domain(n);
+        for (size_t j = 0; j < dom.nPoints(); j++) {
+            for (size_t i = 0; i < dom.nComponents(); i++) {
+                x[dom.loc() + dom.index(i, j)] = sim.value(n, i, j);
+            }
+        }
+    }
+    return x;
+}
+
+TEST(onedim, colored_jacobian)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
+    auto flame = setupFreeFlame(sol, 17);
+    // include transport properties in both Jacobian evaluation methods
+    flame->domain(1).forceFullUpdate(true);
+
+    vector<double> x = getState(*flame);
+    auto jac = std::dynamic_pointer_cast<MultiJac>(flame->linearSolver());
+    ASSERT_TRUE(jac);
+    size_t bw = flame->bandwidth();
+    auto band = [&](size_t i, size_t j) {
+        return (i <= j + bw && j <= i + bw);
+    };
+
+    ASSERT_FALSE(flame->coloredJacobian());
+    flame->evalJacobian(x.data());
+    vector<double> ref(x.size() * x.size(), 0.0);
+    for (size_t i = 0; i < x.size(); i++) {
+        for (size_t j = 0; j < x.size(); j++) {
+            if (band(i, j)) {
+                ref[i * x.size() + j] = jac->value(i, j);
+            }
+        }
+    }
+
+    flame->setColoredJacobian(true);
+    flame->evalJacobian(x.data());
+    for (size_t i = 0; i < x.size(); i++) {
+        for (size_t j = 0; j < x.size(); j++) {
+            if (band(i, j)) {
+                double expected = ref[i * x.size() + j];
+                EXPECT_NEAR(jac->value(i, j), expected, 1e-6 * std::abs(expected) + 1e-8)
+                    << "row " << i << ", column " << j;
+            }
+        }
+    }
+}
+
+TEST(onedim, analytic_chemistry_jacobian)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
+    auto flame = setupFreeFlame(sol, 17);
+    auto& flow = dynamic_cast<Flow1D&>(flame->domain(1));
+    vector<double> x = getState(*flame);
+    size_t N = x.size();
+    // Avoid zero mass fractions, where finite difference derivatives of quadratic
+    // terms in the production rates are inaccurate
+    for (size_t j = 0; j < flow.nPoints(); j++) {
+        for (size_t k = 0; k < sol->thermo()->nSpecies(); k++) {
+            x[flow.loc() + flow.index(c_offset_Y + k, j)] += 1e-3;
+        }
+    }
+    auto jac = std::dynamic_pointer_cast<MultiJac>(flame->linearSolver());
+    size_t bw = flame->bandwidth();
+
+    auto getJacobian = [&]() {
+        flame->evalJacobian(x.data());
+        vector<double> J(N * N, 0.0);
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = (i > bw) ? i - bw : 0; j < std::min(N, i + bw + 1); j++) {
+                J[i * N + j] = jac->value(i, j);
+            }
+        }
+        return J;
+    };
+
+    auto ref = getJacobian();
+    flow.setAnalyticChemistryJacobian(true);
+    ASSERT_TRUE(flow.analyticChemistryJacobian());
+    auto analytic = getJacobian();
+    for (size_t i = 0; i < N; i++) {
+        // allow for truncation error in the finite difference derivatives, and
+        // round-off error relative to the largest element in each row
+        double scale = 0.0;
+        for (size_t j = 0; j < N; j++) {
+            scale = std::max(scale, std::abs(ref[i * N + j]));
+        }
+        for (size_t j = 0; j < N; j++) {
+            double tol = 2e-3 * std::abs(ref[i * N + j]) + 1e-7 * scale;
+            EXPECT_NEAR(analytic[i * N + j], ref[i * N + j], tol)
+                << "row " << i << ", column " << j;
+        }
+    }
+
+    // residual is unaffected after evaluating the Jacobian
+    vector<double> rsd1(N), rsd2(N);
+    flame->eval(npos, x.data(), rsd1.data(), 0.0);
+    flow.setAnalyticChemistryJacobian(false);
+    flame->eval(npos, x.data(), rsd2.data(), 0.0);
+    for (size_t i = 0; i < N; i++) {
+        EXPECT_DOUBLE_EQ(rsd1[i], rsd2[i]);
+    }
+}
+
+TEST(onedim, threaded_residual)
+{
+    for (string model : {"mixture-averaged", "multicomponent"}) {
+        auto sol = newSolution("h2o2.yaml", "ohmech", model);
+        auto flame = setupFreeFlame(sol, 30);
+        auto& flow = dynamic_cast<Flow1D&>(flame->domain(1));
+        vector<double> x = getState(*flame);
+        vector<double> ref(x.size()), rsd(x.size());
+        flame->eval(npos, x.data(), ref.data(), 0.0);
+
+        flow.setNumThreads(4);
+        EXPECT_EQ(flow.numThreads(), 4u);
+        flame->eval(npos, x.data(), rsd.data(), 0.0);
+        for (size_t i = 0; i < x.size(); i++) {
+            EXPECT_NEAR(rsd[i], ref[i], 1e-10 * std::abs(ref[i]) + 1e-14)
+                << model << ", component " << i;
+        }
+
+        // Jacobian evaluated in parallel via coloring
+        flame->setColoredJacobian(true);
+        flame->evalJacobian(x.data());
+        auto jac = std::dynamic_pointer_cast<MultiJac>(flame->linearSolver());
+        vector<double> threaded(x.size());
+        for (size_t i = 0; i < x.size(); i++) {
+            threaded[i] = jac->value(i, i);
+        }
+        flow.setNumThreads(1);
+        EXPECT_EQ(flow.numThreads(), 1u);
+        flame->evalJacobian(x.data());
+        for (size_t i = 0; i < x.size(); i++) {
+            EXPECT_NEAR(threaded[i], jac->value(i, i), 1e-6 * std::abs(threaded[i]))
+                << model << ", diagonal " << i;
+        }
+    }
+}
+
+TEST(onedim, threaded_sensitivities)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
+    auto gas = sol->thermo();
+    auto kin = sol->kinetics();
+    auto flame = setupFreeFlame(sol, 21);
+    auto& flow = dynamic_cast<Flow1D&>(flame->domain(1));
+    flame->solve(0, false);
+    vector<double> x = getState(*flame);
+    size_t N = x.size();
+    size_t kOH = gas->speciesIndex("OH");
+
+    // Sensitivities of the flame speed with respect to reaction rate multipliers
+    // and the heat of formation of OH, using the same approach as the Python
+    // FreeFlame.get_flame_speed_reaction_sensitivities method
+    auto sensitivities = [&]() {
+        vector<double> dgdx(N, 0.0), lambda(N);
+        dgdx[flow.loc() + flow.index(c_offset_U, 0)] = 1.0;
+        flame->solveAdjoint(dgdx.data(), lambda.data());
+        vector<double> r0(N), r1(N);
+        flame->eval(npos, x.data(), r0.data(), 0.0);
+        auto dot = [&]() {
+            double out = 0.0;
+            for (size_t i = 0; i < N; i++) {
+                out -= lambda[i] * (r1[i] - r0[i]);
+            }
+            return out;
+        };
+        vector<double> out;
+        double dp = 1e-5;
+        for (size_t i : {0, 2, 9}) {
+            kin->setMultiplier(i, 1 + dp);
+            flame->eval(npos, x.data(), r1.data(), 0.0);
+            kin->setMultiplier(i, 1.0);
+            out.push_back(dot() / dp);
+        }
+        double Hf298 = gas->Hf298SS(kOH);
+        double dh = 1e3;
+        gas->modifyOneHf298SS(kOH, Hf298 + dh);
+        flame->eval(npos, x.data(), r1.data(), 0.0);
+        gas->resetHf298(kOH);
+        out.push_back(dot() / dh);
+        return out;
+    };
+
+    auto ref = sensitivities();
+    flow.setNumThreads(4);
+    auto threaded = sensitivities();
+    for (size_t i = 0; i < ref.size(); i++) {
+        EXPECT_NE(ref[i], 0.0) << i;
+        EXPECT_NEAR(threaded[i], ref[i], 1e-6 * std::abs(ref[i])) << i;
+    }
+}
+
+TEST(onedim, sparse_linear_solver)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
+    auto banded = setupFreeFlame(sol, 21);
+    banded->solve(0, false);
+    vector<double> xRef = getState(*banded);
+
+    auto sparse = setupFreeFlame(sol, 21);
+    auto jac = std::make_shared<EigenSparseDirectJacobian>();
+    sparse->setLinearSolver(jac);
+    sparse->solve(0, false);
+    vector<double> x = getState(*sparse);
+    ASSERT_EQ(x.size(), xRef.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_NEAR(x[i], xRef[i], 1e-5 * std::abs(xRef[i]) + 1e-10) << i;
+    }
+    // symbolic factorization is reused across Jacobian updates
+    EXPECT_GT(jac->nEvals(), 1);
+    EXPECT_LT(jac->nPatternAnalyses(), jac->nEvals());
+
+    // compare adjoint solutions at the same state. Each solver evaluates its own
+    // finite difference Jacobian, so the tolerance reflects the truncation error of
+    // the Jacobians rather than round-off in the linear solvers.
+    vector<double> b(x.size(), 1.0), lambda(x.size()), lambdaRef(x.size());
+    sparse->solveAdjoint(b.data(), lambda.data());
+    sparse->setLinearSolver(newSystemJacobian("banded-direct"));
+    sparse->solveAdjoint(b.data(), lambdaRef.data());
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_NEAR(lambda[i], lambdaRef[i], 1e-5 * std::abs(lambdaRef[i]) + 1e-10) << i;
+    }
+}
+
+TEST(onedim, jacobian_free_newton)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
+    auto ref = setupFreeFlame(sol, 21);
+    ref->solve(0, false);
+    vector<double> xRef = getState(*ref);
+
+    auto flame = setupFreeFlame(sol, 21);
+    auto& flow = dynamic_cast<Flow1D&>(flame->domain(1));
+    flow.setAnalyticChemistryJacobian(true);
+    flame->setLinearSolver(std::make_shared<EigenSparseDirectJacobian>());
+    flame->setColoredJacobian(true);
+    flame->setJacobianFree(true);
+    EXPECT_TRUE(flame->jacobianFree());
+    flame->solve(0, false);
+    vector<double> x = getState(*flame);
+    ASSERT_EQ(x.size(), xRef.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_NEAR(x[i], xRef[i], 1e-3 * std::abs(xRef[i]) + 1e-8) << i;
+    }
+    auto iters = flame->krylovIterationStats();
+    ASSERT_EQ(iters.size(), 1u);
+    EXPECT_GT(iters[0], 0);
+    EXPECT_EQ(ref->krylovIterationStats()[0], 0);
+
+    // The preconditioner only contains the diagonal block for each grid point
+    vector<size_t> point(x.size());
+    for (size_t j = 0; j < flame->points(); j++) {
+        for (size_t n = 0; n < flame->nVars(j); n++) {
+            point[flame->loc(j) + n] = j;
+        }
+    }
+    auto jac = std::dynamic_pointer_cast<EigenSparseJacobian>(flame->linearSolver());
+    Eigen::SparseMatrix<double> P = jac->jacobian();
+    for (int k = 0; k < P.outerSize(); k++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(P, k); it; ++it) {
+            if (it.value() != 0.0) {
+                EXPECT_EQ(point[it.row()], point[it.col()]);
+            }
+        }
+    }
+}
+
+TEST(onedim, multicomponent_iterative)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
+    auto direct = setupFreeFlame(sol, 21);
+    auto& directFlow = dynamic_cast<Flow1D&>(direct->domain(1));
+    directFlow.setTransportModel("multicomponent");
+    directFlow.enableSoret(true);
+    // Converge both solutions well beyond the differences between the solvers
+    directFlow.setSteadyTolerances(1e-9, 1e-15);
+    direct->solve(0, false);
+    vector<double> xRef = getState(*direct);
+
+    auto flame = setupFreeFlame(sol, 21);
+    auto& flow = dynamic_cast<Flow1D&>(flame->domain(1));
+    flow.setTransportModel("multicomponent-iterative");
+    flow.enableSoret(true);
+    flow.setSteadyTolerances(1e-9, 1e-15);
+    EXPECT_EQ(flow.transportModel(), "multicomponent-iterative");
+    flame->solve(0, false);
+    vector<double> x = getState(*flame);
+    ASSERT_EQ(x.size(), xRef.size());
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_NEAR(x[i], xRef[i], 1e-6 * std::abs(xRef[i]) + 1e-12) << i;
+    }
+}
+
 TEST(onedim, flame_types)
 {
     auto sol = newSolution("h2o2.yaml", "ohmech", "mixture-averaged");
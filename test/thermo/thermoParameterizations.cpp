@@ -134,6 +134,42 @@ TEST(Shomate, modifyOneHf298)
     EXPECT_DOUBLE_EQ(hf, h * 298.15 * GasConstant);
 }
 
+TEST(MultiSpeciesThermo, PackedNasaPolynomials)
+{
+    vector<pair<string, string>> inputs = {
+        {"gri30.yaml", "gri30"}, {"airNASA9.yaml", "airNASA9"}};
+    for (const auto& [file, name] : inputs) {
+        auto sol = newSolution(file, name, "none");
+        auto& spthermo = sol->thermo()->speciesThermo();
+        size_t nsp = sol->thermo()->nSpecies();
+        vector<double> cp_R(nsp), h_RT(nsp), s_R(nsp);
+        for (double T : {300., 999.999, 1000., 1000.001, 2500., 6000., 6000.1, 8000.}) {
+            if (T > spthermo.maxTemp()) {
+                continue;
+            }
+            spthermo.update(T, cp_R.data(), h_RT.data(), s_R.data());
+            for (size_t k = 0; k < nsp; k++) {
+                double cp, h, s;
+                spthermo.update_single(k, T, &cp, &h, &s);
+                EXPECT_DOUBLE_EQ(cp_R[k], cp) << file << ", " << k << ", " << T;
+                EXPECT_DOUBLE_EQ(h_RT[k], h) << file << ", " << k << ", " << T;
+                EXPECT_DOUBLE_EQ(s_R[k], s) << file << ", " << k << ", " << T;
+            }
+        }
+    }
+
+    // Modified parameters are picked up by the packed evaluation
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto& spthermo = sol->thermo()->speciesThermo();
+    size_t nsp = sol->thermo()->nSpecies();
+    vector<double> cp_R(nsp), h_RT(nsp), s_R(nsp);
+    double T = 298.15;
+    double Hnew = -1.5e8;
+    sol->thermo()->modifyOneHf298SS(2, Hnew);
+    spthermo.update(T, cp_R.data(), h_RT.data(), s_R.data());
+    EXPECT_NEAR(h_RT[2] * GasConstant * T, Hnew, 1e-6 * std::abs(Hnew));
+}
+
 TEST(SpeciesThermo, NasaPoly2FromYaml1) {
     AnyMap data = AnyMap::fromYamlString(
         "model: NASA7\n"
@@ -0,0 +1,337 @@
+#include "gtest/gtest.h"
+#include "cantera/core.h"
+#include "cantera/zerodim.h"
+#include "cantera/base/Interface.h"
+#include "cantera/kinetics/Arrhenius.h"
+#include "cantera/kinetics/ReactionRateFactory.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+
+#include <thread>
+
+// Stress tests for concurrent use of independent Solution objects on different
+// threads. These tests exercise the global state shared by all threads, that is,
+// the Application object, the cache of parsed input files, and the object
+// factories. To check for data races, build Cantera with ThreadSanitizer enabled,
+// for example using the SCons options
+//
+//     cc_flags='-fsanitize=thread -g'
+//     thread_flags='-pthread -fsanitize=thread'
+//     system_yamlcpp=n
+//
+// and run the tests using 'scons test-threading'.
+//
+// Libraries that are not compiled with the same flags, such as a system installation
+// of yaml-cpp, may cause spurious reports.
+
+using namespace Cantera;
+
+namespace {
+
+//! Number of threads used by each test
+size_t nThreads()
+{
+    return std::clamp<size_t>(std::thread::hardware_concurrency(), 4, 16);
+}
+
+//! Call `func(i)` on threads `i = 0, ..., n-1` and wait for all of them to finish.
+//! The first exception raised on any thread is rethrown on the calling thread.
+template <class F>
+void runThreads(size_t n, F func)
+{
+    vector<std::exception_ptr> errors(n);
+    vector<std::thread> threads;
+    for (size_t i = 0; i < n; i++) {
+        threads.emplace_back([&func, &errors, i]() {
+            try {
+                func(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+}
+
+//! Properties evaluated for a gas phase Solution
+vector<double> gasProperties(const string& mech, size_t i)
+{
+    auto sol = newSolution(mech, "", "mixture-averaged");
+    auto gas = sol->thermo();
+    gas->setState_TPX(1000.0 + 50.0 * i, OneAtm * (1 + i), "H2:2, O2:1, N2:4");
+    vector<double> out(gas->nSpecies());
+    sol->kinetics()->getNetProductionRates(out.data());
+    vector<double> diff(gas->nSpecies());
+    sol->transport()->getMixDiffCoeffs(diff.data());
+    out.insert(out.end(), diff.begin(), diff.end());
+    out.push_back(gas->enthalpy_mass());
+    out.push_back(sol->transport()->viscosity());
+    out.push_back(sol->transport()->thermalConductivity());
+    return out;
+}
+
+//! Properties evaluated for a surface phase
+vector<double> surfaceProperties(size_t i)
+{
+    auto surf = newInterface("ptcombust.yaml", "Pt_surf");
+    auto gas = surf->adjacent("gas")->thermo();
+    gas->setState_TPX(900.0 + 20.0 * i, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+    surf->thermo()->setTemperature(900.0 + 20.0 * i);
+    auto kin = std::dynamic_pointer_cast<InterfaceKinetics>(surf->kinetics());
+    kin->solvePseudoSteadyStateProblem();
+    vector<double> out(surf->thermo()->nSpecies());
+    surf->thermo()->getMoleFractions(out.data());
+    vector<double> wdot(kin->nTotalSpecies());
+    kin->getNetProductionRates(wdot.data());
+    out.insert(out.end(), wdot.begin(), wdot.end());
+    return out;
+}
+
+//! Final state of a constant pressure reactor integrated for a short time
+vector<double> reactorState(size_t i)
+{
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    sol->thermo()->setState_TPX(1000.0 + 10.0 * i, OneAtm, "H2:2, O2:1, AR:4");
+    auto reactor = newReactor4("IdealGasConstPressureReactor", sol);
+    ReactorNet net(reactor);
+    net.advance(1e-4);
+    vector<double> out(net.neq());
+    net.getState(out.data());
+    return out;
+}
+
+} // namespace
+
+TEST(threading, construct_solutions)
+{
+    vector<string> mechs = {"h2o2.yaml", "gri30.yaml"};
+    size_t n = nThreads();
+    vector<vector<double>> results(n);
+    runThreads(n, [&](size_t i) {
+        results[i] = gasProperties(mechs[i % mechs.size()], i);
+    });
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(results[i], gasProperties(mechs[i % mechs.size()], i)) << i;
+    }
+}
+
+TEST(threading, construct_interfaces)
+{
+    size_t n = nThreads();
+    vector<vector<double>> results(n);
+    runThreads(n, [&](size_t i) {
+        results[i] = surfaceProperties(i);
+    });
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(results[i], surfaceProperties(i)) << i;
+    }
+}
+
+TEST(threading, integrate_reactors)
+{
+    size_t n = nThreads();
+    vector<vector<double>> results(n);
+    runThreads(n, [&](size_t i) {
+        results[i] = reactorState(i);
+    });
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(results[i], reactorState(i)) << i;
+    }
+}
+
+TEST(threading, input_file_cache)
+{
+    size_t n = nThreads();
+    AnyMap ref = AnyMap::fromYamlFile("gri30.yaml");
+    size_t nSpecies = ref["species"].asVector<AnyMap>().size();
+    vector<size_t> counts(n);
+    runThreads(n, [&](size_t i) {
+        for (size_t j = 0; j < 10; j++) {
+            if (i == 0) {
+                // Force other threads to re-parse the file
+                AnyMap::clearCachedFile("gri30.yaml");
+            } else {
+                AnyMap root = AnyMap::fromYamlFile("gri30.yaml");
+                counts[i] += root["species"].asVector<AnyMap>().size();
+            }
+        }
+    });
+    for (size_t i = 1; i < n; i++) {
+        EXPECT_EQ(counts[i], 10 * nSpecies);
+    }
+}
+
+TEST(threading, factory_registration)
+{
+    // Register new reaction rate types while other threads construct objects
+    // using the same factory
+    size_t n = nThreads();
+    auto factory = ReactionRateFactory::factory();
+    runThreads(n, [&](size_t i) {
+        if (i == 0) {
+            for (size_t j = 0; j < 50; j++) {
+                factory->reg(fmt::format("stress-test-rate-{}", j),
+                    [](const AnyMap& node, const UnitStack& rate_units) {
+                        return new ArrheniusRate(node, rate_units);
+                    });
+            }
+        } else {
+            for (size_t j = 0; j < 5; j++) {
+                auto sol = newSolution("h2o2.yaml", "", "none");
+                EXPECT_EQ(sol->kinetics()->nReactions(), 29u);
+                EXPECT_TRUE(factory->exists("Arrhenius"));
+            }
+        }
+    });
+    for (size_t j = 0; j < 50; j++) {
+        EXPECT_TRUE(factory->exists(fmt::format("stress-test-rate-{}", j)));
+    }
+    AnyMap rate = AnyMap::fromYamlString(
+        "{type: stress-test-rate-7, rate-constant: {A: 1.0e+10, b: 0.0, Ea: 0.0}}");
+    EXPECT_EQ(newReactionRate(rate)->type(), "Arrhenius");
+}
+
+TEST(threading, yaml_field_order)
+{
+    // Register YAML field ordering rules while other threads serialize objects
+    // using the same rules
+    size_t n = nThreads();
+    runThreads(n, [&](size_t i) {
+        if (i == 0) {
+            for (size_t j = 0; j < 50; j++) {
+                AnyMap::addOrderingRules(fmt::format("stress-test-{}", j),
+                                         {{"head", "a"}, {"tail", "c"}});
+            }
+        } else {
+            for (size_t j = 0; j < 50; j++) {
+                AnyMap m;
+                m["c"] = 3;
+                m["b"] = 2;
+                m["a"] = 1;
+                m["__type__"] = fmt::format("stress-test-{}", j);
+                string out = m.toYamlString();
+                EXPECT_NE(out.find("b: 2"), string::npos);
+            }
+        }
+    });
+    AnyMap m;
+    m["c"] = 3;
+    m["b"] = 2;
+    m["a"] = 1;
+    m["__type__"] = "stress-test-7";
+    string out = m.toYamlString();
+    EXPECT_LT(out.find("a: 1"), out.find("b: 2"));
+    EXPECT_LT(out.find("b: 2"), out.find("c: 3"));
+}
+
+TEST(threading, batch_net_production_rates)
+{
+    // Evaluate net production rates for different states on several threads sharing
+    // the same Kinetics object
+    auto sol = newSolution("gri30.yaml", "gri30", "none");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    size_t n = nThreads();
+    size_t nStates = 20;
+    vector<double> T(n * nStates), P(n * nStates), Y(n * nStates * nsp);
+    for (size_t i = 0; i < n * nStates; i++) {
+        T[i] = 1000. + 5. * i;
+        P[i] = OneAtm * (1 + i % 3);
+        gas->setState_TPX(T[i], P[i], "CH4:1, O2:2, N2:7.52, OH:0.01, H:0.01");
+        gas->getMassFractions(&Y[i * nsp]);
+    }
+    vector<double> ref(n * nStates * nsp);
+    sol->kinetics()->getNetProductionRatesBatch(n * nStates, T.data(), P.data(),
+                                                Y.data(), ref.data());
+
+    vector<vector<double>> results(n, vector<double>(nStates * nsp));
+    runThreads(n, [&](size_t i) {
+        for (size_t j = 0; j < 10; j++) {
+            sol->kinetics()->getNetProductionRatesBatch(nStates, &T[i * nStates],
+                &P[i * nStates], &Y[i * nStates * nsp], results[i].data());
+        }
+    });
+    for (size_t i = 0; i < n; i++) {
+        vector<double> expected(ref.begin() + i * nStates * nsp,
+                                ref.begin() + (i + 1) * nStates * nsp);
+        EXPECT_EQ(results[i], expected) << i;
+    }
+}
+
+TEST(threading, batch_stale_species_thermo)
+{
+    // Species thermo modified after the last evaluation is evaluated per species
+    // until the packed coefficient tables are rebuilt; this path also needs to be
+    // safe for concurrent use. NASA9 polynomials select the temperature region for
+    // each evaluation.
+    AnyMap root = AnyMap::fromYamlString(
+        "phases:\n"
+        "- name: air\n"
+        "  thermo: ideal-gas\n"
+        "  species: [{airNASA9.yaml/species: [N2, O2, NO, N, O]}]\n"
+        "  kinetics: gas\n"
+        "reactions:\n"
+        "- equation: N2 + O <=> NO + N\n"
+        "  rate-constant: {A: 6.4e+17, b: -1.0, Ea: 3.837e+04 cal/mol}\n"
+        "- equation: N + O2 <=> NO + O\n"
+        "  rate-constant: {A: 6.4e+09, b: 1.0, Ea: 6285.0 cal/mol}\n");
+    auto sol = newSolution(root["phases"].getMapWhere("name", "air"), root, "none");
+    auto gas = sol->thermo();
+    size_t nsp = gas->nSpecies();
+    size_t n = nThreads();
+    size_t nStates = 20;
+    vector<double> T(n * nStates), P(n * nStates), Y(n * nStates * nsp);
+    for (size_t i = 0; i < n * nStates; i++) {
+        // span several temperature regions of the NASA9 polynomials
+        T[i] = 500. + 19000. * i / (n * nStates);
+        P[i] = OneAtm;
+        gas->setState_TPX(T[i], P[i], "N2:0.7, O2:0.2, NO:0.01, N:0.01, O:0.08");
+        gas->getMassFractions(&Y[i * nsp]);
+    }
+    // mark packed tables as stale
+    size_t kNO = gas->speciesIndex("NO");
+    gas->modifySpecies(kNO, gas->species(kNO));
+    vector<double> ref(n * nStates * nsp);
+    sol->kinetics()->getNetProductionRatesBatch(n * nStates, T.data(), P.data(),
+                                                Y.data(), ref.data());
+
+    vector<vector<double>> results(n, vector<double>(nStates * nsp));
+    runThreads(n, [&](size_t i) {
+        for (size_t j = 0; j < 10; j++) {
+            sol->kinetics()->getNetProductionRatesBatch(nStates, &T[i * nStates],
+                &P[i * nStates], &Y[i * nStates * nsp], results[i].data());
+        }
+    });
+    for (size_t i = 0; i < n; i++) {
+        vector<double> expected(ref.begin() + i * nStates * nsp,
+                                ref.begin() + (i + 1) * nStates * nsp);
+        EXPECT_EQ(results[i], expected) << i;
+    }
+
+    // per-species evaluation is consistent with the packed tables
+    vector<double> wdot(nsp);
+    for (size_t i = 0; i < n * nStates; i++) {
+        gas->setState_TPY(T[i], P[i], &Y[i * nsp]);
+        sol->kinetics()->getNetProductionRates(wdot.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(ref[i * nsp + k], wdot[k], 1e-10 * std::abs(wdot[k]) + 1e-20)
+                << i << ", " << k;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    printf("Running main() from test_threading.cpp\n");
+    testing::InitGoogleTest(&argc, argv);
+    Cantera::make_deprecation_warnings_fatal();
+    int result = RUN_ALL_TESTS();
+    Cantera::appdelete();
+    return result;
+}
@@ -6,6 +6,7 @@
 #include "cantera/core.h"
 #include "cantera/transport/TransportFactory.h"
 #include "cantera/transport/MultiTransport.h"
+#include "cantera/transport/ApproxMixTransport.h"
 
 using namespace Cantera;
 
@@ -160,6 +161,41 @@ TEST_F(GasTransportTest, mixtureViscosity)
     }
 }
 
+TEST_F(GasTransportTest, approximateMixtureViscosity)
+{
+    auto approx = std::dynamic_pointer_cast<ApproxMixTransport>(
+        newTransport(s_thermo, "mixture-averaged-approximate"));
+    ASSERT_TRUE(approx);
+    EXPECT_EQ(approx->transportModel(), "mixture-averaged-approximate");
+    vector<double> dRef(nsp), d(nsp);
+    for (size_t i = 0; i < 10; i++) {
+        double T = 400. + 100. * i;
+        s_thermo->setState_TP(T, P0);
+        double visc = s_mix->viscosity();
+        approx->setDominantSpeciesThreshold(0.0);
+        EXPECT_NEAR(approx->viscosity(), visc, 1e-12 * visc) << T;
+        approx->setDominantSpeciesThreshold(1e-4);
+        EXPECT_NEAR(approx->viscosity(), visc, 2e-4 * visc) << T;
+        approx->setDominantSpeciesThreshold(1e-2);
+        EXPECT_NEAR(approx->viscosity(), visc, 2e-2 * visc) << T;
+
+        // other properties are the same as for the mixture-averaged model
+        EXPECT_DOUBLE_EQ(approx->thermalConductivity(), s_mix->thermalConductivity());
+        s_mix->getMixDiffCoeffs(dRef.data());
+        approx->getMixDiffCoeffs(d.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(d[k], dRef[k]) << k;
+        }
+    }
+    EXPECT_THROW(approx->setDominantSpeciesThreshold(-1.0), CanteraError);
+
+    auto approxCK = newTransport(s_thermo, "mixture-averaged-approximate-CK");
+    EXPECT_EQ(approxCK->transportModel(), "mixture-averaged-approximate-CK");
+    auto mixCK = newTransport(s_thermo, "mixture-averaged-CK");
+    s_thermo->setState_TP(T1, P0);
+    EXPECT_NEAR(approxCK->viscosity(), mixCK->viscosity(), 2e-4 * mixCK->viscosity());
+}
+
 TEST_F(GasTransportTest, thermalDiffCoeffs)
 {
     // regression test based on case from legacy multiGasTransport.cpp
@@ -410,3 +446,56 @@ TEST_F(GasTransportTest, getFluxes_multi)
     }
     EXPECT_NEAR(netFlux, 0.0, 1e-19);
 }
+
+TEST_F(GasTransportTest, iterativeMulticomponent)
+{
+    auto iter = std::dynamic_pointer_cast<MultiTransport>(
+        newTransport(s_thermo, "multicomponent-iterative"));
+    ASSERT_TRUE(iter);
+    EXPECT_TRUE(iter->iterativeSolver());
+    EXPECT_FALSE(s_multi->iterativeSolver());
+    EXPECT_EQ(iter->transportModel(), "multicomponent-iterative");
+
+    vector<double> dtRef(nsp), dt(nsp);
+    for (size_t i = 0; i < 10; i++) {
+        double T = 400. + 100. * i;
+        s_thermo->setState_TPX(T, P0, X0.data());
+        double cond = s_multi->thermalConductivity();
+        EXPECT_NEAR(iter->thermalConductivity(), cond, 1e-8 * cond) << T;
+        s_multi->getThermalDiffCoeffs(dtRef.data());
+        iter->getThermalDiffCoeffs(dt.data());
+        double tol = 1e-8 * *std::max_element(dtRef.begin(), dtRef.end(),
+            [](double a, double b) { return fabs(a) < fabs(b); });
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_NEAR(dt[k], dtRef[k], fabs(tol)) << k;
+        }
+    }
+
+    // The previous solution is a good initial guess for a nearby state
+    s_thermo->setState_TPX(T1, P0, X0.data());
+    iter->thermalConductivity();
+    size_t nCold = iter->lastIterationCount();
+    s_thermo->setState_TPX(T1 + 0.1, P0, X0.data());
+    iter->thermalConductivity();
+    EXPECT_GT(nCold, 0u);
+    EXPECT_LT(iter->lastIterationCount(), nCold);
+
+    vector<double> state2, state3, fluxRef(nsp), flux(nsp);
+    s_thermo->setState_TPX(T2, P0,
+        "H2:0.25, H:0.0001, H2O:0.17, CO:0.15, CO2:0.05, NO:0.001, N2: 0.38");
+    s_thermo->saveState(state2);
+    s_thermo->setState_TPX(T3, P0, "H2:0.27, H2O:0.18, CO:0.13, CO2:0.04, N2: 0.38");
+    s_thermo->saveState(state3);
+    s_multi->getMassFluxes(state2.data(), state3.data(), dist, fluxRef.data());
+    iter->getMassFluxes(state2.data(), state3.data(), dist, flux.data());
+    double netFlux = 0.0;
+    for (size_t k = 0; k < nsp; k++) {
+        EXPECT_NEAR(flux[k], fluxRef[k], 1e-8 * fabs(fluxRef[k]) + 1e-20) << k;
+        netFlux += flux[k];
+    }
+    EXPECT_NEAR(netFlux, 0.0, 1e-19);
+
+    EXPECT_THROW(iter->setIterativeSolver(true, 0.0), CanteraError);
+    auto iterCK = newTransport(s_thermo, "multicomponent-iterative-CK");
+    EXPECT_EQ(iterCK->transportModel(), "multicomponent-iterative-CK");
+}
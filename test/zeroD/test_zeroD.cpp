@@ -3,6 +3,7 @@
 #include "cantera/kinetics.h"
 #include "cantera/zerodim.h"
 #include "cantera/base/Interface.h"
+#include "cantera/base/SolutionArray.h"
 #include "cantera/numerics/eigen_sparse.h"
 #include "cantera/numerics/SystemJacobianFactory.h"
 #include "cantera/numerics/AdaptivePreconditioner.h"
@@ -97,6 +98,229 @@ TEST(zerodim, wall)
     ASSERT_EQ(node1->nWalls(), 1);
 }
 
+TEST(zerodim, parallel_eval)
+{
+    // A chain of reactors coupled by walls, with a valve between the first two
+    struct Network {
+        vector<shared_ptr<ReactorBase>> reactors;
+        vector<shared_ptr<ConnectorNode>> connectors;
+        shared_ptr<ReactorNet> net;
+    };
+    auto makeNetwork = [](Network& network, bool shared) {
+        auto& reactors = network.reactors;
+        auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+        for (size_t i = 0; i < 4; i++) {
+            if (!shared && i) {
+                sol = newSolution("h2o2.yaml", "ohmech", "none");
+            }
+            sol->thermo()->setState_TPX(1000 + 100 * i, OneAtm * (1 + 0.1 * i),
+                                        "H2:2, O2:1, AR:4");
+            reactors.push_back(newReactor4("IdealGasReactor", sol));
+            if (i) {
+                auto wall = std::dynamic_pointer_cast<Wall>(
+                    newWall("Wall", reactors[i-1], reactors[i]));
+                wall->setHeatTransferCoeff(100.0);
+                wall->setExpansionRateCoeff(1e-6);
+                network.connectors.push_back(wall);
+            }
+        }
+        auto valve = newFlowDevice("Valve", reactors[1], reactors[0]);
+        std::dynamic_pointer_cast<Valve>(valve)->setValveCoeff(1e-6);
+        network.connectors.push_back(valve);
+        network.net = make_shared<ReactorNet>(reactors);
+        return network.net;
+    };
+
+    Network serialNetwork, parallelNetwork, sharedNetwork;
+    auto serial = makeNetwork(serialNetwork, false);
+    auto parallel = makeNetwork(parallelNetwork, false);
+    parallel->setNumThreads(3);
+    EXPECT_EQ(parallel->numThreads(), 3u);
+    serial->initialize();
+    parallel->initialize();
+
+    size_t nv = serial->neq();
+    ASSERT_EQ(parallel->neq(), nv);
+    vector<double> y(nv), ydotSerial(nv), ydotParallel(nv);
+    serial->getState(y.data());
+    serial->eval(0.0, y.data(), ydotSerial.data(), nullptr);
+    parallel->eval(0.0, y.data(), ydotParallel.data(), nullptr);
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_EQ(ydotSerial[i], ydotParallel[i]) << i;
+    }
+
+    serial->advance(1e-5);
+    parallel->advance(1e-5);
+    vector<double> ySerial(nv), yParallel(nv);
+    serial->getState(ySerial.data());
+    parallel->getState(yParallel.data());
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_EQ(ySerial[i], yParallel[i]) << i;
+    }
+
+    // Reactors sharing a Solution fall back to serial evaluation
+    auto shared = makeNetwork(sharedNetwork, true);
+    shared->setNumThreads(3);
+    shared->initialize();
+    shared->getState(y.data());
+    shared->eval(0.0, y.data(), ydotParallel.data(), nullptr);
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_EQ(ydotSerial[i], ydotParallel[i]) << i;
+    }
+}
+
+TEST(zerodim, reactor_ensemble)
+{
+    auto sol = newSolution("h2o2.yaml", "ohmech", "none");
+    auto initial = SolutionArray::create(sol, 6);
+    vector<double> state(sol->thermo()->stateSize());
+    for (int i = 0; i < initial->size(); i++) {
+        sol->thermo()->setState_TPX(1200 + 50 * i, OneAtm * (1 + i % 2),
+                                    "H2:2, O2:1, AR:4");
+        sol->thermo()->saveState(state);
+        initial->setState(i, state);
+    }
+
+    ReactorEnsemble ensemble("h2o2.yaml", "ohmech");
+    ensemble.setEndTime(5e-4);
+    auto serial = ensemble.integrate(*initial);
+    ensemble.setNumThreads(3);
+    EXPECT_EQ(ensemble.numThreads(), 3u);
+    auto parallel = ensemble.integrate(*initial);
+
+    ASSERT_EQ(serial->size(), initial->size());
+    ASSERT_EQ(parallel->size(), initial->size());
+    auto tSerial = serial->getComponent("ignition-delay").asVector<double>();
+    auto tParallel = parallel->getComponent("ignition-delay").asVector<double>();
+    auto TSerial = serial->getComponent("T").asVector<double>();
+    auto TParallel = parallel->getComponent("T").asVector<double>();
+    auto steps = parallel->getComponent("steps").asVector<long int>();
+    for (int i = 0; i < initial->size(); i++) {
+        EXPECT_EQ(tSerial[i], tParallel[i]);
+        EXPECT_EQ(TSerial[i], TParallel[i]);
+        EXPECT_GT(tSerial[i], 0.0);
+        EXPECT_LT(tSerial[i], 5e-4);
+        EXPECT_GT(TSerial[i], 2000.0);
+        EXPECT_GT(steps[i], 0);
+    }
+    // Higher initial temperature at the same pressure ignites faster
+    EXPECT_LT(tSerial[2], tSerial[0]);
+    EXPECT_LT(tSerial[3], tSerial[1]);
+}
+
+// Integrate the mixture in gas for a time dt without tabulation
+static vector<double> isatReference(shared_ptr<Solution> gas, double dt)
+{
+    auto reactor = newReactor4("IdealGasConstPressureMoleReactor", gas);
+    ReactorNet net(reactor);
+    net.advance(dt);
+    vector<double> state(gas->thermo()->nSpecies() + 1);
+    state[0] = gas->thermo()->temperature();
+    gas->thermo()->getMassFractions(state.data() + 1);
+    return state;
+}
+
+TEST(zerodim, isat)
+{
+    auto gas = newSolution("h2o2.yaml", "ohmech", "none");
+    auto ref = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& thermo = *gas->thermo();
+    size_t nsp = thermo.nSpecies();
+    double dt = 1e-5;
+    ReactorISAT isat(gas);
+    EXPECT_THROW(isat.setTolerance(0.0), CanteraError);
+    EXPECT_THROW(isat.advance(0.0), CanteraError);
+
+    auto query = [&](double T) {
+        thermo.setState_TPX(T, OneAtm, "H2:2, O2:1, N2:3.76");
+        ref->thermo()->setState_TPX(T, OneAtm, "H2:2, O2:1, N2:3.76");
+        isat.advance(dt);
+        vector<double> state(nsp + 1);
+        state[0] = thermo.temperature();
+        thermo.getMassFractions(state.data() + 1);
+        return state;
+    };
+
+    // The first query adds a record with the result of direct integration
+    auto added = query(1400.0);
+    auto expected = isatReference(ref, dt);
+    EXPECT_GT(added[0], 1400.1);
+    EXPECT_NEAR(added[0], expected[0], 1e-2);
+    for (size_t k = 1; k <= nsp; k++) {
+        EXPECT_NEAR(added[k], expected[k], 1e-5);
+    }
+    EXPECT_EQ(isat.nRecords(), 1u);
+
+    // Repeating the query retrieves the same result
+    auto retrieved = query(1400.0);
+    for (size_t i = 0; i <= nsp; i++) {
+        EXPECT_NEAR(retrieved[i], added[i], 1e-14 * std::abs(added[i]) + 1e-18);
+    }
+
+    // Nearby points are retrieved or grow the EOA, and are within the tolerance
+    // of direct integration
+    for (double T : {1400.02, 1400.05, 1400.1, 1401.0}) {
+        auto approx = query(T);
+        expected = isatReference(ref, dt);
+        EXPECT_NEAR(approx[0], expected[0], 2e-4 * 1000.0) << T;
+        for (size_t k = 1; k <= nsp; k++) {
+            EXPECT_NEAR(approx[k], expected[k], 2e-4) << T << " " << k;
+        }
+    }
+    EXPECT_EQ(isat.nRecords(), 1u);
+
+    // A distant point requires a new record
+    query(1600.0);
+    EXPECT_EQ(isat.nRecords(), 2u);
+
+    AnyMap stats = isat.stats();
+    EXPECT_EQ(stats["queries"].asInt(), 7);
+    EXPECT_GE(stats["retrieves"].asInt(), 2);
+    EXPECT_EQ(stats["adds"].asInt(), 2);
+    EXPECT_EQ(stats["retrieves"].asInt() + stats["grows"].asInt()
+              + stats["adds"].asInt(), 7);
+    // Each query that is not retrieved requires exactly one direct integration
+    EXPECT_EQ(stats["direct-integrations"].asInt(),
+              stats["grows"].asInt() + stats["adds"].asInt());
+    EXPECT_DOUBLE_EQ(stats["hit-rate"].asDouble(), stats["retrieves"].asInt() / 7.0);
+}
+
+TEST(zerodim, isat_eviction)
+{
+    auto gas = newSolution("h2o2.yaml", "ohmech", "none");
+    auto& thermo = *gas->thermo();
+    ReactorISAT isat(gas);
+    isat.setMaxRecords(2);
+    auto query = [&](double T, double P=OneAtm) {
+        thermo.setState_TPX(T, P, "H2:2, O2:1, N2:3.76");
+        isat.advance(1e-5);
+    };
+    for (double T : {1300.0, 1400.0, 1600.0}) {
+        query(T);
+    }
+    EXPECT_EQ(isat.nRecords(), 2u);
+    EXPECT_EQ(isat.stats()["adds"].asInt(), 3);
+    EXPECT_EQ(isat.stats()["evictions"].asInt(), 1);
+
+    // The least recently used record was removed
+    query(1400.0);
+    EXPECT_EQ(isat.stats()["retrieves"].asInt(), 1);
+    query(1300.0);
+    EXPECT_EQ(isat.stats()["adds"].asInt(), 4);
+    EXPECT_EQ(isat.nRecords(), 2u);
+
+    // The record for 1600 K was the least recently used one
+    query(1400.0);
+    EXPECT_EQ(isat.stats()["retrieves"].asInt(), 2);
+    query(1600.0);
+    EXPECT_EQ(isat.stats()["adds"].asInt(), 5);
+    EXPECT_EQ(isat.stats()["evictions"].asInt(), 3);
+
+    // Changing the pressure clears the table
+    query(1400.0, 2 * OneAtm);
+    EXPECT_EQ(isat.nRecords(), 1u);
+}
+
 TEST(zerodim, mole_reactor)
 {
     // simplified version of continuous_reactor.py
@@ -301,6 +525,97 @@ TEST(AdaptivePreconditionerTests, test_precon_solver_stats)
     EXPECT_GE(stats["nonlinear_conv_fails"].asInt(), 0);
 }
 
+TEST(AdaptivePreconditionerTests, pattern_reuse)
+{
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    sol->thermo()->setState_TPX(1200.0, OneAtm, "H2:2.0, O2:1.0, AR:4.0, OH:0.01");
+    auto reactor = newReactor4("IdealGasMoleReactor", sol);
+    ReactorNet network(reactor);
+    network.initialize();
+    Eigen::SparseMatrix<double> J = reactor->jacobian();
+    size_t n = J.rows();
+
+    AdaptivePreconditioner reuse, fresh;
+    EXPECT_TRUE(reuse.reusePattern());
+    fresh.setReusePattern(false);
+    reuse.initialize(n);
+    fresh.initialize(n);
+    vector<double> rhs(n, 1.0), x1(n), x2(n);
+    for (double gamma : {1e-6, 3e-6, 5e-7}) {
+        for (auto precon : {&reuse, &fresh}) {
+            precon->reset();
+            precon->setGamma(gamma);
+            double scale = 1 + 1e5 * gamma; // vary values between updates
+            for (int k = 0; k < J.outerSize(); k++) {
+                for (Eigen::SparseMatrix<double>::InnerIterator it(J, k); it; ++it) {
+                    precon->setValue(it.row(), it.col(), scale * it.value());
+                }
+            }
+            precon->updatePreconditioner();
+        }
+        reuse.solve(n, rhs.data(), x1.data());
+        fresh.solve(n, rhs.data(), x2.data());
+        for (size_t i = 0; i < n; i++) {
+            EXPECT_DOUBLE_EQ(x1[i], x2[i]);
+        }
+    }
+    EXPECT_EQ(reuse.nPatternAnalyses(), 1);
+    EXPECT_EQ(fresh.nPatternAnalyses(), 3);
+
+    // elements at new positions require a new analysis
+    reuse.reset();
+    reuse.setValue(0, n - 1, 1.0);
+    reuse.updatePreconditioner();
+    EXPECT_EQ(reuse.nPatternAnalyses(), 2);
+}
+
+TEST(AdaptivePreconditionerTests, jacobian_reuse_policy)
+{
+    auto sol = newSolution("h2o2.yaml", "", "none");
+    sol->thermo()->setState_TPX(1200.0, OneAtm, "H2:2.0, O2:1.0, AR:4.0");
+    auto reactor = newReactor4("IdealGasMoleReactor", sol);
+    ReactorNet network(reactor);
+    auto precon = newSystemJacobian("Adaptive");
+    network.setPreconditioner(precon);
+    network.setLinearSolverType("GMRES");
+    network.initialize();
+    vector<double> y(network.neq());
+    network.getState(y.data());
+
+    // Jacobian is evaluated for each setup by default
+    network.preconditionerSetup(0.0, y.data(), 1e-6);
+    network.preconditionerSetup(1e-7, y.data(), 1.1e-6);
+    EXPECT_EQ(precon->nEvals(), 2);
+    EXPECT_TRUE(network.preconditionerJacobianCurrent());
+
+    network.setPreconditionerReuse(2, 0.3);
+    EXPECT_THROW(network.setPreconditionerReuse(-1), CanteraError);
+    network.preconditionerSetup(2e-7, y.data(), 1.2e-6);
+    EXPECT_EQ(precon->nEvals(), 2);
+    EXPECT_EQ(precon->age(), 1);
+    EXPECT_FALSE(network.preconditionerJacobianCurrent());
+    EXPECT_DOUBLE_EQ(precon->gamma(), 1.2e-6);
+
+    // repeated request at the same time
+    network.preconditionerSetup(2e-7, y.data(), 1.2e-6);
+    EXPECT_EQ(precon->nEvals(), 3);
+    EXPECT_EQ(precon->age(), 0);
+    EXPECT_TRUE(network.preconditionerJacobianCurrent());
+
+    // maximum age
+    network.preconditionerSetup(3e-7, y.data(), 1.2e-6);
+    network.preconditionerSetup(4e-7, y.data(), 1.2e-6);
+    EXPECT_EQ(precon->nEvals(), 3);
+    EXPECT_EQ(precon->age(), 2);
+    network.preconditionerSetup(5e-7, y.data(), 1.2e-6);
+    EXPECT_EQ(precon->nEvals(), 4);
+
+    // large change of gamma
+    network.preconditionerSetup(6e-7, y.data(), 2e-6);
+    EXPECT_EQ(precon->nEvals(), 5);
+    EXPECT_TRUE(network.preconditionerJacobianCurrent());
+}
+
 int main(int argc, char** argv)
 {
     printf("Running main() from test_zeroD.cpp\n");